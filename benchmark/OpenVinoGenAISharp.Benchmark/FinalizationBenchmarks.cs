@@ -0,0 +1,102 @@
+﻿using System;
+using System.Runtime.InteropServices;
+using BenchmarkDotNet.Attributes;
+using OpenVinoSharp.GenAI.Internal;
+
+namespace OpenVinoSharp.GenAI.Benchmark
+{
+    /// <summary>
+    /// Cost of releasing result objects built on <see cref="DisposableOvObject"/> or <see cref="OvSafeHandle"/>,
+    /// disposed or left to the finalizer.
+    /// </summary>
+    [MemoryDiagnoser]
+    public class FinalizationBenchmarks
+    {
+        private const int Objects = 1000;
+        private IntPtr slot;
+
+        /// <summary>
+        /// A result object owning a native handle of the stub library.
+        /// </summary>
+        private sealed class StubResult : DisposableOvObject
+        {
+            public StubResult(IntPtr ptr)
+                : base(ptr)
+            {
+            }
+
+            protected override void DisposeUnmanaged()
+            {
+                NativeMethods.ov_genai_tokenizer_free(ptr);
+                base.DisposeUnmanaged();
+            }
+        }
+
+        [GlobalSetup]
+        public void Setup()
+        {
+            slot = Marshal.AllocHGlobal(IntPtr.Size);
+        }
+
+        [GlobalCleanup]
+        public void Cleanup()
+        {
+            Marshal.FreeHGlobal(slot);
+        }
+
+        private StubResult Create()
+        {
+            NativeMethods.ov_genai_tokenizer_create(slot);
+            return new StubResult(Marshal.ReadIntPtr(slot));
+        }
+
+        /// <summary>
+        /// Dispose called by the user, the finalizer is suppressed.
+        /// </summary>
+        [Benchmark(Baseline = true, OperationsPerInvoke = Objects)]
+        public void ExplicitDispose()
+        {
+            for (int i = 0; i < Objects; ++i)
+            {
+                using StubResult result = Create();
+            }
+        }
+
+        /// <summary>
+        /// Objects dropped without Dispose, released by the finalizer thread after a full collection.
+        /// </summary>
+        [Benchmark(OperationsPerInvoke = Objects)]
+        public void FinalizerThread()
+        {
+            for (int i = 0; i < Objects; ++i)
+                Create();
+            GC.Collect();
+            GC.WaitForPendingFinalizers();
+        }
+
+        /// <summary>
+        /// A <see cref="TokenizerHandle"/> returned by the P/Invoke marshaller and disposed.
+        /// </summary>
+        [Benchmark(OperationsPerInvoke = Objects)]
+        public void SafeHandleDispose()
+        {
+            for (int i = 0; i < Objects; ++i)
+            {
+                NativeMethods.ov_genai_tokenizer_create(out TokenizerHandle handle);
+                handle.Dispose();
+            }
+        }
+
+        /// <summary>
+        /// Handles dropped without Dispose, released by the critical finalizer.
+        /// </summary>
+        [Benchmark(OperationsPerInvoke = Objects)]
+        public void SafeHandleFinalizer()
+        {
+            for (int i = 0; i < Objects; ++i)
+                NativeMethods.ov_genai_tokenizer_create(out TokenizerHandle _);
+            GC.Collect();
+            GC.WaitForPendingFinalizers();
+        }
+    }
+}
@@ -0,0 +1,19 @@
+﻿using System;
+using BenchmarkDotNet.Running;
+
+namespace OpenVinoSharp.GenAI.Benchmark
+{
+    /// <summary>
+    /// Runs the P/Invoke marshalling benchmarks against the stub openvino_genai_c.
+    /// </summary>
+    /// <example>
+    /// dotnet run -c Release -- --filter *StringArray*
+    /// </example>
+    public static class Program
+    {
+        public static void Main(string[] args)
+        {
+            BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly).Run(args);
+        }
+    }
+}
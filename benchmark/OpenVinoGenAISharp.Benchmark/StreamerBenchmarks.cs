@@ -0,0 +1,84 @@
+﻿using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using BenchmarkDotNet.Attributes;
+
+namespace OpenVinoSharp.GenAI.Benchmark
+{
+    /// <summary>
+    /// Cost of the native to managed call made for every generated token by a streamer.
+    /// </summary>
+    [MemoryDiagnoser]
+    public unsafe class StreamerBenchmarks
+    {
+        private static int received;
+        private int count;
+        private StubMethods.StreamerCallback? callback;
+
+        [Params(128)]
+        public int Tokens { get; set; }
+
+        [GlobalSetup]
+        public void Setup()
+        {
+            // kept in a field, the delegate must outlive every native call that may use it
+            callback = OnToken;
+        }
+
+        private static int OnToken(IntPtr text, IntPtr userData)
+        {
+            received += Marshal.PtrToStringUTF8(text)!.Length;
+            return 0;
+        }
+
+        [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+        private static int OnTokenUnmanaged(IntPtr text, IntPtr userData)
+        {
+            received += Marshal.PtrToStringUTF8(text)!.Length;
+            return 0;
+        }
+
+        [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+        private static int OnTokenWithState(IntPtr text, IntPtr userData)
+        {
+            var target = (StreamerBenchmarks)GCHandle.FromIntPtr(userData).Target!;
+            target.count += Marshal.PtrToStringUTF8(text)!.Length;
+            return 0;
+        }
+
+        /// <summary>
+        /// A delegate marshalled to a function pointer, which goes through a reverse P/Invoke thunk.
+        /// </summary>
+        [Benchmark(Baseline = true)]
+        public UIntPtr MarshalledDelegate()
+        {
+            return StubMethods.ov_genai_stub_stream(callback!, IntPtr.Zero, (UIntPtr)Tokens);
+        }
+
+        /// <summary>
+        /// A static <see cref="UnmanagedCallersOnlyAttribute"/> method passed as a function pointer.
+        /// </summary>
+        [Benchmark]
+        public UIntPtr UnmanagedCallersOnly()
+        {
+            return StubMethods.ov_genai_stub_stream(&OnTokenUnmanaged, IntPtr.Zero, (UIntPtr)Tokens);
+        }
+
+        /// <summary>
+        /// The same with the receiver passed back as a GCHandle in user_data, the shape a per request streamer needs.
+        /// </summary>
+        [Benchmark]
+        public UIntPtr UnmanagedCallersOnlyWithState()
+        {
+            GCHandle handle = GCHandle.Alloc(this);
+            try
+            {
+                return StubMethods.ov_genai_stub_stream(&OnTokenWithState, GCHandle.ToIntPtr(handle), (UIntPtr)Tokens);
+            }
+            finally
+            {
+                handle.Free();
+            }
+        }
+    }
+}
@@ -0,0 +1,76 @@
+﻿using System;
+using System.Runtime.InteropServices;
+using BenchmarkDotNet.Attributes;
+using OpenVinoSharp.GenAI.Internal;
+
+namespace OpenVinoSharp.GenAI.Benchmark
+{
+    /// <summary>
+    /// Cost of passing a prompt batch as <see cref="StringArray"/>.
+    /// </summary>
+    [MemoryDiagnoser]
+    public class StringArrayBenchmarks
+    {
+        private string[] prompts = Array.Empty<string>();
+        private IntPtr[] pointers = Array.Empty<IntPtr>();
+        private readonly Utf8StringArray arena = new Utf8StringArray();
+
+        [Params(1, 8, 512)]
+        public int Count { get; set; }
+
+        [GlobalSetup]
+        public void Setup()
+        {
+            prompts = new string[Count];
+            for (int i = 0; i < Count; ++i)
+                prompts[i] = "Prompt " + i + ": what is OpenVINO, and how does it speed up inference on Intel hardware?";
+            pointers = new IntPtr[Count];
+        }
+
+        [GlobalCleanup]
+        public void Cleanup()
+        {
+            arena.Dispose();
+        }
+
+        /// <summary>
+        /// The former StringArrayToStruct, one ANSI HGlobal per string plus one for the pointer table.
+        /// </summary>
+        [Benchmark(Baseline = true)]
+        public ExceptionStatus PerStringAnsi()
+        {
+            for (int i = 0; i < prompts.Length; ++i)
+                pointers[i] = Marshal.StringToHGlobalAnsi(prompts[i]);
+            IntPtr data = Marshal.AllocHGlobal(IntPtr.Size * prompts.Length);
+            Marshal.Copy(pointers, 0, data, prompts.Length);
+            ExceptionStatus status = NativeMethods.ov_genai_tokenizer_encode_strings(IntPtr.Zero,
+                new StringArray { Data = data, Size = (ulong)prompts.Length }, IntPtr.Zero);
+            foreach (IntPtr pointer in pointers)
+                Marshal.FreeHGlobal(pointer);
+            Marshal.FreeHGlobal(data);
+            return status;
+        }
+
+        /// <summary>
+        /// <see cref="StructCommon.StringArrayToStruct"/>, one UTF-8 block per call.
+        /// </summary>
+        [Benchmark]
+        public ExceptionStatus StructCommonSingleBlock()
+        {
+            StringArray array = StructCommon.StringArrayToStruct(prompts);
+            ExceptionStatus status = NativeMethods.ov_genai_tokenizer_encode_strings(IntPtr.Zero, array, IntPtr.Zero);
+            StructCommon.FreeStringArray(array);
+            return status;
+        }
+
+        /// <summary>
+        /// <see cref="Utf8StringArray"/> reused across calls, no allocation once it has grown.
+        /// </summary>
+        [Benchmark]
+        public ExceptionStatus PooledArena()
+        {
+            StringArray array = arena.Encode(prompts);
+            return NativeMethods.ov_genai_tokenizer_encode_strings(IntPtr.Zero, array, IntPtr.Zero);
+        }
+    }
+}
@@ -0,0 +1,87 @@
+﻿using System;
+using System.Runtime.InteropServices;
+using System.Text;
+using BenchmarkDotNet.Attributes;
+using OpenVinoSharp.GenAI.Internal;
+
+namespace OpenVinoSharp.GenAI.Benchmark
+{
+    /// <summary>
+    /// Cost of passing one string argument, as every model path and prompt is passed.
+    /// </summary>
+    [MemoryDiagnoser]
+    public unsafe class StringMarshallingBenchmarks
+    {
+        private string text = "";
+        private IntPtr slot;
+
+        [Params(16, 1024)]
+        public int Length { get; set; }
+
+        [GlobalSetup]
+        public void Setup()
+        {
+            // ends with two characters that take three bytes each in UTF-8
+            text = new string('m', Length - 2) + "模型";
+            slot = Marshal.AllocHGlobal(IntPtr.Size);
+        }
+
+        [GlobalCleanup]
+        public void Cleanup()
+        {
+            Marshal.FreeHGlobal(slot);
+        }
+
+        /// <summary>
+        /// The current declaration, <c>[MarshalAs(StringUnmanagedTypeNotWindows)] string</c>.
+        /// </summary>
+        [Benchmark(Baseline = true)]
+        public ExceptionStatus MarshalAsUtf8()
+        {
+            return NativeMethods.ov_genai_tokenizer_create_with_path_NotWindows(text, slot);
+        }
+
+        /// <summary>
+        /// The Windows declaration, <c>[MarshalAs(StringUnmanagedTypeWindows)] string</c>.
+        /// </summary>
+        [Benchmark]
+        public ExceptionStatus MarshalAsAnsi()
+        {
+            return NativeMethods.ov_genai_tokenizer_create_with_path_Windows(text, slot);
+        }
+
+        /// <summary>
+        /// The dispatching wrapper, which also pays for the platform check on every call.
+        /// </summary>
+        [Benchmark]
+        public ExceptionStatus PlatformDispatch()
+        {
+            return NativeMethods.ov_genai_tokenizer_create_with_path(text, slot);
+        }
+
+        /// <summary>
+        /// UTF-8 encoded by the caller into a stack buffer, falling back to the heap for long strings.
+        /// </summary>
+        [Benchmark]
+        public int ManualUtf8Stackalloc()
+        {
+            int max = Encoding.UTF8.GetMaxByteCount(text.Length) + 1;
+            Span<byte> buffer = max <= 512 ? stackalloc byte[max] : new byte[max];
+            int written = Encoding.UTF8.GetBytes(text, buffer);
+            buffer[written] = 0;
+            fixed (byte* path = buffer)
+            {
+                return StubMethods.ov_genai_tokenizer_create_with_path(path, slot);
+            }
+        }
+
+        /// <summary>
+        /// The source-generated blittable layer, <see cref="BlittableNativeMethods"/>.
+        /// </summary>
+        [Benchmark]
+        public ExceptionStatus LibraryImportBlittable()
+        {
+            return BlittableNativeMethods.ov_genai_tokenizer_create_with_path(text.AsSpan(), out _);
+        }
+    }
+}
@@ -0,0 +1,42 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace OpenVinoSharp.GenAI.Benchmark
+{
+    /// <summary>
+    /// Declarations the benchmarks compare with the ones in <see cref="Internal.NativeMethods"/>.
+    /// They bind to the same exports of the stub library, only the marshalling differs.
+    /// </summary>
+    internal static unsafe class StubMethods
+    {
+        private const string dllExtern = "openvino_genai_c";
+
+        /// <summary>
+        /// Streamer callback of ov_genai_stub_stream, returns nonzero to stop the generation.
+        /// </summary>
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate int StreamerCallback(IntPtr text, IntPtr userData);
+
+        /// <summary>
+        /// ov_genai_tokenizer_create_with_path with the path already encoded by the caller.
+        /// </summary>
+        [DllImport(dllExtern, EntryPoint = "ov_genai_tokenizer_create_with_path",
+            CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public extern static int ov_genai_tokenizer_create_with_path(byte* tokenizerPath, IntPtr tokenizer);
+
+        /// <summary>
+        /// Calls the callback once per token, the callback is marshalled from a delegate.
+        /// </summary>
+        [DllImport(dllExtern, EntryPoint = "ov_genai_stub_stream",
+            CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public extern static UIntPtr ov_genai_stub_stream(StreamerCallback callback, IntPtr userData, UIntPtr tokens);
+
+        /// <summary>
+        /// Calls the callback once per token, the callback is an unmanaged function pointer.
+        /// </summary>
+        [DllImport(dllExtern, EntryPoint = "ov_genai_stub_stream",
+            CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public extern static UIntPtr ov_genai_stub_stream(delegate* unmanaged[Cdecl]<IntPtr, IntPtr, int> callback,
+            IntPtr userData, UIntPtr tokens);
+    }
+}
@@ -0,0 +1,97 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file genai_stub.c
+* @brief This is a stand-in for openvino_genai_c used by OpenVinoGenAISharp.Benchmark. It exports the
+* entry points the benchmarks call with the same names and argument layout, but does no inference, so
+* what is measured is the managed to native transition and the marshalling around it.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/24
+*/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#    define STUB_API __declspec(dllexport)
+#else
+#    define STUB_API __attribute__((visibility("default")))
+#endif
+
+typedef struct {
+    char** string_array;
+    size_t size;
+} ov_genai_char_arrays_t;
+
+typedef struct {
+    int64_t token_count;
+} stub_tokenizer_t;
+
+static volatile size_t stub_sink;
+
+STUB_API int ov_genai_llm_sizeof(void) {
+    return (int)sizeof(stub_tokenizer_t);
+}
+
+STUB_API const char* ov_genai_get_error_info(int status) {
+    return status == 0 ? "OK" : "GENERAL_ERROR";
+}
+
+STUB_API const char* ov_genai_get_last_err_msg(void) {
+    return NULL;
+}
+
+STUB_API void ov_genai_free(const char* content) {
+    free((void*)content);
+}
+
+/* The managed declaration passes the address of a pointer sized slot by value. */
+STUB_API int ov_genai_tokenizer_create(void** tokenizer) {
+    if (!tokenizer)
+        return -14;
+    *tokenizer = calloc(1, sizeof(stub_tokenizer_t));
+    return 0;
+}
+
+/* Reads the path like the real wrapper does when it builds the std::string. */
+STUB_API int ov_genai_tokenizer_create_with_path(const char* tokenizer_path, void** tokenizer) {
+    if (!tokenizer_path || !tokenizer)
+        return -14;
+    stub_sink = strlen(tokenizer_path);
+    *tokenizer = NULL;
+    return 0;
+}
+
+STUB_API void ov_genai_tokenizer_free(void* tokenizer) {
+    free(tokenizer);
+}
+
+STUB_API int ov_genai_tokenizer_encode_strings(void* tokenizer, ov_genai_char_arrays_t prompts, void** tokenized_inputs) {
+    size_t length = 0;
+    (void)tokenizer;
+    (void)tokenized_inputs;
+    for (size_t i = 0; i < prompts.size; ++i)
+        length += strlen(prompts.string_array[i]);
+    stub_sink = length;
+    return 0;
+}
+
+/**
+ * Not part of openvino_genai_c. Calls callback once per token with a short UTF-8 piece, the way a
+ * streamer is called back during generation, and stops early when the callback returns nonzero.
+ */
+typedef int (*stub_streamer_callback_t)(const char* text, void* user_data);
+
+STUB_API size_t ov_genai_stub_stream(stub_streamer_callback_t callback, void* user_data, size_t tokens) {
+    static const char* pieces[] = { " the", " quick", " brown", " fox", " jumps", " over", " a", " lazy", " dog", "." };
+    size_t i = 0;
+    for (; i < tokens; ++i) {
+        if (callback(pieces[i % (sizeof(pieces) / sizeof(pieces[0]))], user_data))
+            return i + 1;
+    }
+    return i;
+}
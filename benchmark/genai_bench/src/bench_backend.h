@@ -0,0 +1,64 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file bench_backend.h
+* @brief This is a header file for the genai_bench backends, the pipelines the harness drives.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/20
+*/
+
+#pragma once
+#include <memory>
+
+#include "bench_common.h"
+
+/**
+ * @class bench_backend
+ * @brief A pipeline driven by the harness loop.
+ * Requests are queued with submit and make progress only inside step, so every backend
+ * runs on the harness thread and the timestamps of a request are written by that thread only.
+ */
+class bench_backend {
+public:
+    virtual ~bench_backend() = default;
+
+    /**
+     * @brief Name written into the report.
+     */
+    virtual const char* name() const = 0;
+
+    /**
+     * @brief Counts the prompt tokens, called before the run so tokenization stays out of the timed loop.
+     */
+    virtual size_t count_tokens(const std::string& prompt) = 0;
+
+    /**
+     * @brief Queues a request, its arrival_ms is already set.
+     */
+    virtual void submit(bench_request* request) = 0;
+
+    /**
+     * @brief Advances the pipeline and fills first_token_ms, end_ms and output_tokens.
+     * @return The number of requests that finished or failed during the call.
+     */
+    virtual size_t step() = 0;
+
+    /**
+     * @brief The number of submitted requests that did not finish yet.
+     */
+    virtual size_t in_flight() const = 0;
+
+    /**
+     * @brief KV cache usage in percent, negative when the backend does not report it.
+     */
+    virtual float kv_usage() = 0;
+};
+
+std::unique_ptr<bench_backend> bench_create_llm_backend(const bench_options& options);
+
+std::unique_ptr<bench_backend> bench_create_continuous_batching_backend(const bench_options& options);
+
+std::unique_ptr<bench_backend> bench_create_synthetic_backend(const bench_options& options);
@@ -0,0 +1,178 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file bench_backend_cb.cpp
+* @brief This is a source file for the genai_bench backend driving ov_genai_continuous_batching_pipeline_*.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/20
+*/
+
+#include <vector>
+
+#include "bench_backend.h"
+#include "bench_genai.h"
+
+// Values of ov::genai::GenerationStatus returned by ov_genai_generation_handle_get_status.
+static const int GENERATION_STATUS_RUNNING = 0;
+static const int GENERATION_STATUS_FINISHED = 1;
+
+/**
+ * @class bench_cb_backend
+ * @brief Requests are added to the pipeline on arrival and advanced together by step().
+ */
+class bench_cb_backend : public bench_backend {
+public:
+    explicit bench_cb_backend(const bench_options& options)
+        : m_ids(options.max_new_tokens) {
+        ov_genai_scheduler_config_t scheduler_config;
+        scheduler_config.cache_size = options.cache_size;
+        scheduler_config.max_num_batched_tokens = options.max_num_batched_tokens;
+        scheduler_config.max_num_seqs = options.max_num_seqs;
+        scheduler_config.dynamic_split_fuse = true;
+        bench_genai_check(ov_genai_continuous_batching_pipeline_create_with_scheduler_device(
+            &m_pipeline, options.model_path.c_str(), &scheduler_config, options.device.c_str()),
+            "Create ContinuousBatchingPipeline");
+        bench_genai_check(ov_genai_continuous_batching_pipeline_get_tokenizer(m_pipeline, &m_tokenizer), "Get tokenizer");
+        m_config = bench_genai_create_config(options);
+    }
+
+    ~bench_cb_backend() override {
+        for (auto& active : m_active)
+            ov_genai_generation_handle_free(active.handle);
+        ov_genai_generation_config_free(m_config);
+        ov_genai_tokenizer_free(m_tokenizer);
+        ov_genai_continuous_batching_pipeline_free(m_pipeline);
+    }
+
+    const char* name() const override {
+        return "cb";
+    }
+
+    size_t count_tokens(const std::string& prompt) override {
+        return bench_genai_count_tokens(m_tokenizer, prompt);
+    }
+
+    void submit(bench_request* request) override {
+        ov_genai_generation_handle_t* handle = nullptr;
+        ov_status_e status = ov_genai_continuous_batching_pipeline_get_metrics_add_request_with_prompt(
+            m_pipeline, ++m_last_id, request->prompt.c_str(), m_config, &handle);
+        if (status != ov_status_e::OK) {
+            request->failed = true;
+            request->error = bench_genai_error(status);
+            request->end_ms = bench_now_ms();
+            ++m_rejected;
+            return;
+        }
+        m_active.push_back({ request, handle });
+    }
+
+    size_t step() override {
+        size_t done = m_rejected;
+        m_rejected = 0;
+        if (m_active.empty())
+            return done;
+
+        ov_status_e status = ov_genai_continuous_batching_pipeline_step(m_pipeline);
+        double now = bench_now_ms();
+        if (status != ov_status_e::OK) {
+            std::string error = bench_genai_error(status);
+            for (auto& active : m_active) {
+                active.request->failed = true;
+                active.request->error = error;
+                active.request->end_ms = now;
+                ov_genai_generation_handle_free(active.handle);
+            }
+            done += m_active.size();
+            m_active.clear();
+            return done;
+        }
+
+        for (size_t i = 0; i < m_active.size();) {
+            bench_request* request = m_active[i].request;
+            ov_genai_generation_handle_t* handle = m_active[i].handle;
+            size_t tokens = read_new_tokens(handle);
+            if (tokens > 0) {
+                if (request->first_token_ms < 0.0)
+                    request->first_token_ms = now;
+                request->output_tokens += tokens;
+            }
+            int generation_status = GENERATION_STATUS_RUNNING;
+            ov_genai_generation_handle_get_status(handle, &generation_status);
+            if (generation_status == GENERATION_STATUS_RUNNING) {
+                ++i;
+                continue;
+            }
+            request->end_ms = now;
+            if (generation_status != GENERATION_STATUS_FINISHED) {
+                request->failed = true;
+                request->error = "Request dropped by the pipeline, status " + std::to_string(generation_status);
+            }
+            ov_genai_generation_handle_free(handle);
+            m_active[i] = m_active.back();
+            m_active.pop_back();
+            ++done;
+        }
+        return done;
+    }
+
+    size_t in_flight() const override {
+        return m_active.size() + m_rejected;
+    }
+
+    float kv_usage() override {
+        ov_genai_pipeline_metrics_t metrics;
+        if (ov_genai_continuous_batching_pipeline_get_metrics(m_pipeline, &metrics) != ov_status_e::OK)
+            return -1.0f;
+        return metrics.cache_usage;
+    }
+
+private:
+    struct active_request {
+        bench_request* request;
+        ov_genai_generation_handle_t* handle;
+    };
+
+    /**
+     * @brief Reads the tokens produced by the last step, greedy requests hold a single sequence.
+     */
+    size_t read_new_tokens(ov_genai_generation_handle_t* handle) {
+        int can_read = 0;
+        if (ov_genai_generation_handle_can_read(handle, &can_read) != ov_status_e::OK || !can_read)
+            return 0;
+        ov_genai_generation_outputs_t* outputs = nullptr;
+        if (ov_genai_generation_handle_read(handle, &outputs) != ov_status_e::OK)
+            return 0;
+        size_t tokens = 0, size = 0;
+        uint64_t key = 0;
+        if (ov_genai_generation_outputs_get_size(outputs, &size) == ov_status_e::OK && size == 1
+            && ov_genai_generation_outputs_get_keys(outputs, &key, &size) == ov_status_e::OK) {
+            ov_genai_generation_output_t* output = nullptr;
+            if (ov_genai_generation_outputs_at(outputs, key, &output) == ov_status_e::OK) {
+                if (ov_genai_generation_output_copy_generated_ids(output, m_ids.data(), m_ids.size(), &tokens)
+                    == ov_status_e::OK && tokens > m_ids.size()) {
+                    m_ids.resize(tokens);
+                    ov_genai_generation_output_copy_generated_ids(output, m_ids.data(), m_ids.size(), &tokens);
+                }
+                ov_genai_generation_output_free(output);
+            }
+        }
+        ov_genai_generation_outputs_free(outputs);
+        return tokens;
+    }
+
+    ov_genai_continuous_batching_pipeline_t* m_pipeline = nullptr;
+    ov_genai_tokenizer_t* m_tokenizer = nullptr;
+    ov_genai_generation_config_t* m_config = nullptr;
+    std::vector<active_request> m_active;
+    // a step never produces more ids for one sequence than max_new_tokens
+    std::vector<int64_t> m_ids;
+    uint64_t m_last_id = 0;
+    size_t m_rejected = 0;
+};
+
+std::unique_ptr<bench_backend> bench_create_continuous_batching_backend(const bench_options& options) {
+    return std::unique_ptr<bench_backend>(new bench_cb_backend(options));
+}
@@ -0,0 +1,104 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file bench_backend_llm.cpp
+* @brief This is a source file for the genai_bench backend driving ov_genai_llm_pipeline_*.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/20
+*/
+
+#include <deque>
+
+#include "bench_backend.h"
+#include "bench_genai.h"
+
+// The streamer callback carries no user data, LLMPipeline runs one request at a time
+// on the harness thread so the request being generated is kept here.
+static bench_request* streaming_request = nullptr;
+
+static bool __stdcall on_token(std::string) {
+    if (streaming_request && streaming_request->first_token_ms < 0.0)
+        streaming_request->first_token_ms = bench_now_ms();
+    return false;
+}
+
+/**
+ * @class bench_llm_backend
+ * @brief LLMPipeline serves requests one after another, queued requests wait for the current generate call.
+ */
+class bench_llm_backend : public bench_backend {
+public:
+    explicit bench_llm_backend(const bench_options& options) {
+        bench_genai_check(ov_genai_llm_pipeline_create_with_model_path(
+            options.model_path.c_str(), options.device.c_str(), &m_pipeline, nullptr), "Create LLMPipeline");
+        bench_genai_check(ov_genai_llm_pipeline_generate_get_tokenizer(m_pipeline, &m_tokenizer), "Get tokenizer");
+        m_config = bench_genai_create_config(options);
+    }
+
+    ~bench_llm_backend() override {
+        ov_genai_generation_config_free(m_config);
+        ov_genai_tokenizer_free(m_tokenizer);
+        ov_genai_llm_pipeline_free(m_pipeline);
+    }
+
+    const char* name() const override {
+        return "llm";
+    }
+
+    size_t count_tokens(const std::string& prompt) override {
+        return bench_genai_count_tokens(m_tokenizer, prompt);
+    }
+
+    void submit(bench_request* request) override {
+        m_queue.push_back(request);
+    }
+
+    size_t step() override {
+        if (m_queue.empty())
+            return 0;
+        bench_request* request = m_queue.front();
+        m_queue.pop_front();
+
+        streaming_request = request;
+        ov_genai_streamer_callback_t callback = on_token;
+        ov_genai_decoded_results_t* decoded_results = nullptr;
+        ov_status_e status = ov_genai_llm_pipeline_generate_string_with_config_function(
+            m_pipeline, request->prompt.c_str(), m_config, &callback, &decoded_results);
+        request->end_ms = bench_now_ms();
+        streaming_request = nullptr;
+
+        if (status != ov_status_e::OK) {
+            request->failed = true;
+            request->error = bench_genai_error(status);
+            return 1;
+        }
+        ov_genai_perf_metrics_t* perf_metrics = nullptr;
+        if (ov_genai_decoded_results_get_perf_metrics(decoded_results, &perf_metrics) == ov_status_e::OK) {
+            ov_genai_get_num_generated_tokens(perf_metrics, &request->output_tokens);
+            ov_genai_perf_metrics_free(perf_metrics);
+        }
+        ov_genai_decoded_results_free(decoded_results);
+        return 1;
+    }
+
+    size_t in_flight() const override {
+        return m_queue.size();
+    }
+
+    float kv_usage() override {
+        return -1.0f;
+    }
+
+private:
+    ov_genai_llm_pipeline_t* m_pipeline = nullptr;
+    ov_genai_tokenizer_t* m_tokenizer = nullptr;
+    ov_genai_generation_config_t* m_config = nullptr;
+    std::deque<bench_request*> m_queue;
+};
+
+std::unique_ptr<bench_backend> bench_create_llm_backend(const bench_options& options) {
+    return std::unique_ptr<bench_backend>(new bench_llm_backend(options));
+}
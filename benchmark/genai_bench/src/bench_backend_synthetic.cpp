@@ -0,0 +1,120 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file bench_backend_synthetic.cpp
+* @brief This is a source file for the genai_bench synthetic backend, a simulated continuous batching
+* engine that needs no model, so the harness itself can be exercised on CPU-only CI machines.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/20
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <thread>
+#include <vector>
+
+#include "bench_backend.h"
+
+/**
+ * @class bench_synthetic_backend
+ * @brief Every step admits waiting prompts within the token budget, charges their prefill cost plus
+ * a fixed and a per sequence decode cost, and gives every running sequence one token.
+ * A request reserves prompt + max_new_tokens KV slots on admission, so the cache never overflows.
+ */
+class bench_synthetic_backend : public bench_backend {
+public:
+    explicit bench_synthetic_backend(const bench_options& options)
+        : m_options(options) {}
+
+    const char* name() const override {
+        return "synthetic";
+    }
+
+    size_t count_tokens(const std::string& prompt) override {
+        // about four tokens for three words with a typical BPE vocabulary
+        size_t words = 0;
+        bool in_word = false;
+        for (char c : prompt) {
+            bool space = c == ' ' || c == '\t' || c == '\n' || c == '\r';
+            if (!space && !in_word)
+                ++words;
+            in_word = !space;
+        }
+        return words == 0 ? 1 : (words * 4 + 2) / 3;
+    }
+
+    void submit(bench_request* request) override {
+        m_waiting.push_back(request);
+    }
+
+    size_t step() override {
+        double cost_us = m_options.synthetic_step_us;
+        size_t budget = m_options.max_num_batched_tokens;
+        std::vector<sequence> admitted;
+        while (!m_waiting.empty() && m_running.size() + admitted.size() < m_options.max_num_seqs) {
+            bench_request* request = m_waiting.front();
+            size_t reserve = request->input_tokens + m_options.max_new_tokens;
+            bool first = m_running.empty() && admitted.empty();
+            if (!first && (request->input_tokens > budget || m_reserved + reserve > m_options.synthetic_kv_tokens))
+                break;
+            budget -= std::min(budget, request->input_tokens);
+            m_reserved += reserve;
+            m_used += request->input_tokens;
+            cost_us += m_options.synthetic_prefill_us_per_token * request->input_tokens;
+            admitted.push_back({ request, reserve });
+            m_waiting.pop_front();
+        }
+        cost_us += m_options.synthetic_step_us_per_seq * (m_running.size() + admitted.size());
+        std::this_thread::sleep_for(std::chrono::microseconds(static_cast<int64_t>(cost_us)));
+
+        double now = bench_now_ms();
+        m_running.insert(m_running.end(), admitted.begin(), admitted.end());
+        size_t done = 0;
+        for (size_t i = 0; i < m_running.size();) {
+            bench_request* request = m_running[i].request;
+            if (request->first_token_ms < 0.0)
+                request->first_token_ms = now;
+            ++request->output_tokens;
+            ++m_used;
+            if (request->output_tokens < m_options.max_new_tokens) {
+                ++i;
+                continue;
+            }
+            request->end_ms = now;
+            m_reserved -= m_running[i].reserved;
+            m_used -= request->input_tokens + request->output_tokens;
+            m_running[i] = m_running.back();
+            m_running.pop_back();
+            ++done;
+        }
+        return done;
+    }
+
+    size_t in_flight() const override {
+        return m_waiting.size() + m_running.size();
+    }
+
+    float kv_usage() override {
+        return 100.0f * static_cast<float>(m_used) / static_cast<float>(m_options.synthetic_kv_tokens);
+    }
+
+private:
+    struct sequence {
+        bench_request* request;
+        size_t reserved;
+    };
+
+    bench_options m_options;
+    std::deque<bench_request*> m_waiting;
+    std::vector<sequence> m_running;
+    size_t m_reserved = 0;
+    size_t m_used = 0;
+};
+
+std::unique_ptr<bench_backend> bench_create_synthetic_backend(const bench_options& options) {
+    return std::unique_ptr<bench_backend>(new bench_synthetic_backend(options));
+}
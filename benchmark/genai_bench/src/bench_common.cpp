@@ -0,0 +1,272 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file bench_common.cpp
+* @brief This is a source file for the genai_bench options, dataset loading and process probes.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/20
+*/
+
+#include "bench_common.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <unistd.h>
+#endif
+
+double bench_now_ms() {
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+size_t bench_rss_bytes() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return counters.WorkingSetSize;
+    return 0;
+#elif defined(__linux__)
+    FILE* file = std::fopen("/proc/self/statm", "r");
+    if (!file)
+        return 0;
+    unsigned long long pages = 0, resident = 0;
+    int read = std::fscanf(file, "%llu %llu", &pages, &resident);
+    std::fclose(file);
+    return read == 2 ? static_cast<size_t>(resident) * static_cast<size_t>(sysconf(_SC_PAGESIZE)) : 0;
+#else
+    return 0;
+#endif
+}
+
+void bench_print_usage() {
+    std::printf(
+        "Usage: genai_bench [options]\n"
+        "  --backend <llm|cb|synthetic>     pipeline to drive (default synthetic)\n"
+        "  --model <dir>                    model directory, required by llm and cb\n"
+        "  --device <name>                  device name (default CPU)\n"
+        "  --dataset <file>                 prompts, one per line or JSON lines with a \"prompt\" field\n"
+        "  --output <file>                  JSON report path (default stdout)\n"
+        "  --load <closed|poisson>          arrival process (default closed)\n"
+        "  --concurrency <n>                requests in flight for the closed loop (default 1)\n"
+        "  --rate <req/s>                   mean arrival rate for the poisson load (default 1)\n"
+        "  --num-requests <n>               requests to send, the dataset is cycled (default dataset size)\n"
+        "  --warmup <n>                     requests sent before measuring (default 0)\n"
+        "  --max-new-tokens <n>             tokens generated per request (default 128)\n"
+        "  --ignore-eos <0|1>               generate max-new-tokens tokens for every request (default 1)\n"
+        "  --seed <n>                       seed of the arrival process (default 42)\n"
+        "  --sample-interval <ms>           period of the RSS and KV usage timeline (default 100)\n"
+        "  --cache-size <GB>                continuous batching KV cache size (default 1)\n"
+        "  --max-num-batched-tokens <n>     continuous batching scheduler budget (default 256)\n"
+        "  --max-num-seqs <n>               continuous batching sequence limit (default 64)\n"
+        "  --synthetic-prefill-us <us>      synthetic prefill cost per prompt token (default 50)\n"
+        "  --synthetic-step-us <us>         synthetic fixed cost of one step (default 5000)\n"
+        "  --synthetic-step-us-per-seq <us> synthetic cost of one step per running sequence (default 200)\n"
+        "  --synthetic-kv-tokens <n>        synthetic KV cache capacity in tokens (default 16384)\n");
+}
+
+static bool parse_size(const char* text, size_t& value) {
+    char* end = nullptr;
+    unsigned long long parsed = std::strtoull(text, &end, 10);
+    if (!end || *end != '\0' || text[0] == '-')
+        return false;
+    value = static_cast<size_t>(parsed);
+    return true;
+}
+
+static bool parse_double(const char* text, double& value) {
+    char* end = nullptr;
+    double parsed = std::strtod(text, &end);
+    if (!end || *end != '\0' || parsed < 0.0)
+        return false;
+    value = parsed;
+    return true;
+}
+
+bool bench_parse_options(int argc, char* argv[], bench_options& options, std::string& error) {
+    for (int i = 1; i < argc; ++i) {
+        std::string key = argv[i];
+        if (i + 1 >= argc) {
+            error = "Missing value of option " + key;
+            return false;
+        }
+        const char* value = argv[++i];
+        bool ok = true;
+        size_t seed = 0;
+        if (key == "--backend") {
+            if (std::strcmp(value, "llm") == 0)
+                options.backend = bench_backend_e::LLM;
+            else if (std::strcmp(value, "cb") == 0)
+                options.backend = bench_backend_e::CONTINUOUS_BATCHING;
+            else if (std::strcmp(value, "synthetic") == 0)
+                options.backend = bench_backend_e::SYNTHETIC;
+            else
+                ok = false;
+        }
+        else if (key == "--load") {
+            if (std::strcmp(value, "closed") == 0)
+                options.load = bench_load_e::CLOSED_LOOP;
+            else if (std::strcmp(value, "poisson") == 0)
+                options.load = bench_load_e::POISSON;
+            else
+                ok = false;
+        }
+        else if (key == "--model")
+            options.model_path = value;
+        else if (key == "--device")
+            options.device = value;
+        else if (key == "--dataset")
+            options.dataset_path = value;
+        else if (key == "--output")
+            options.output_path = value;
+        else if (key == "--concurrency")
+            ok = parse_size(value, options.concurrency) && options.concurrency > 0;
+        else if (key == "--rate")
+            ok = parse_double(value, options.request_rate) && options.request_rate > 0.0;
+        else if (key == "--num-requests")
+            ok = parse_size(value, options.num_requests);
+        else if (key == "--warmup")
+            ok = parse_size(value, options.warmup);
+        else if (key == "--max-new-tokens")
+            ok = parse_size(value, options.max_new_tokens) && options.max_new_tokens > 0;
+        else if (key == "--ignore-eos") {
+            ok = std::strcmp(value, "0") == 0 || std::strcmp(value, "1") == 0;
+            options.ignore_eos = std::strcmp(value, "1") == 0;
+        }
+        else if (key == "--seed") {
+            ok = parse_size(value, seed);
+            options.seed = static_cast<uint32_t>(seed);
+        }
+        else if (key == "--sample-interval")
+            ok = parse_double(value, options.sample_interval_ms) && options.sample_interval_ms > 0.0;
+        else if (key == "--cache-size")
+            ok = parse_size(value, options.cache_size);
+        else if (key == "--max-num-batched-tokens")
+            ok = parse_size(value, options.max_num_batched_tokens);
+        else if (key == "--max-num-seqs")
+            ok = parse_size(value, options.max_num_seqs) && options.max_num_seqs > 0;
+        else if (key == "--synthetic-prefill-us")
+            ok = parse_double(value, options.synthetic_prefill_us_per_token);
+        else if (key == "--synthetic-step-us")
+            ok = parse_double(value, options.synthetic_step_us);
+        else if (key == "--synthetic-step-us-per-seq")
+            ok = parse_double(value, options.synthetic_step_us_per_seq);
+        else if (key == "--synthetic-kv-tokens")
+            ok = parse_size(value, options.synthetic_kv_tokens) && options.synthetic_kv_tokens > 0;
+        else {
+            error = "Unknown option " + key;
+            return false;
+        }
+        if (!ok) {
+            error = "Invalid value of option " + key + ": " + value;
+            return false;
+        }
+    }
+    if (options.dataset_path.empty()) {
+        error = "--dataset is required";
+        return false;
+    }
+    if (options.backend != bench_backend_e::SYNTHETIC && options.model_path.empty()) {
+        error = "--model is required by the llm and cb backends";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Reads the string value of "prompt" from one JSON line, only the escapes JSON defines are handled.
+ */
+static bool json_prompt_field(const std::string& line, std::string& prompt) {
+    size_t key = line.find("\"prompt\"");
+    if (key == std::string::npos)
+        return false;
+    size_t pos = line.find(':', key + 8);
+    if (pos == std::string::npos)
+        return false;
+    pos = line.find('"', pos + 1);
+    if (pos == std::string::npos)
+        return false;
+    prompt.clear();
+    for (++pos; pos < line.size(); ++pos) {
+        char c = line[pos];
+        if (c == '"')
+            return true;
+        if (c != '\\') {
+            prompt.push_back(c);
+            continue;
+        }
+        if (++pos >= line.size())
+            return false;
+        switch (line[pos]) {
+        case 'n': prompt.push_back('\n'); break;
+        case 't': prompt.push_back('\t'); break;
+        case 'r': prompt.push_back('\r'); break;
+        case 'b': prompt.push_back('\b'); break;
+        case 'f': prompt.push_back('\f'); break;
+        case 'u': {
+            if (pos + 4 >= line.size())
+                return false;
+            unsigned code = static_cast<unsigned>(std::strtoul(line.substr(pos + 1, 4).c_str(), nullptr, 16));
+            pos += 4;
+            if (code < 0x80) {
+                prompt.push_back(static_cast<char>(code));
+            }
+            else if (code < 0x800) {
+                prompt.push_back(static_cast<char>(0xC0 | (code >> 6)));
+                prompt.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+            }
+            else {
+                prompt.push_back(static_cast<char>(0xE0 | (code >> 12)));
+                prompt.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+                prompt.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+            }
+            break;
+        }
+        default: prompt.push_back(line[pos]); break;
+        }
+    }
+    return false;
+}
+
+bool bench_load_dataset(const std::string& path, std::vector<std::string>& prompts, std::string& error) {
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+        error = "Cannot open the dataset " + path;
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if (line.empty())
+            continue;
+        std::string prompt;
+        if (line.front() == '{') {
+            if (!json_prompt_field(line, prompt)) {
+                error = "No \"prompt\" string in dataset line " + std::to_string(prompts.size() + 1);
+                return false;
+            }
+        }
+        else {
+            prompt = line;
+        }
+        prompts.push_back(std::move(prompt));
+    }
+    if (prompts.empty()) {
+        error = "The dataset " + path + " holds no prompt";
+        return false;
+    }
+    return true;
+}
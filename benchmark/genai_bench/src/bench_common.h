@@ -0,0 +1,133 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file bench_common.h
+* @brief This is a header file for the genai_bench harness, which replays a prompt dataset
+* against the ov_genai pipeline C API and reports latency, throughput and memory as JSON.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/20
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @enum bench_backend_e
+ * @brief The pipeline the requests are sent to.
+ */
+enum class bench_backend_e {
+    LLM,                  //!< ov_genai_llm_pipeline_*, one request at a time.
+    CONTINUOUS_BATCHING,  //!< ov_genai_continuous_batching_pipeline_*, driven by step().
+    SYNTHETIC,            //!< A simulated continuous batching engine, needs no model.
+};
+
+/**
+ * @enum bench_load_e
+ * @brief How the requests arrive.
+ */
+enum class bench_load_e {
+    CLOSED_LOOP,  //!< A fixed number of requests in flight, the next one is sent when one finishes.
+    POISSON,      //!< Open loop, requests arrive with exponential gaps at a fixed mean rate.
+};
+
+/**
+ * @struct bench_options
+ * @brief Command line options of the harness.
+ */
+struct bench_options {
+    bench_backend_e backend = bench_backend_e::SYNTHETIC;
+    std::string model_path;
+    std::string device = "CPU";
+    std::string dataset_path;
+    std::string output_path;
+
+    bench_load_e load = bench_load_e::CLOSED_LOOP;
+    size_t concurrency = 1;
+    double request_rate = 1.0;
+    size_t num_requests = 0;
+    size_t warmup = 0;
+    size_t max_new_tokens = 128;
+    bool ignore_eos = true;
+    uint32_t seed = 42;
+    double sample_interval_ms = 100.0;
+
+    // continuous batching scheduler
+    size_t cache_size = 1;
+    size_t max_num_batched_tokens = 256;
+    size_t max_num_seqs = 64;
+
+    // synthetic engine
+    double synthetic_prefill_us_per_token = 50.0;
+    double synthetic_step_us = 5000.0;
+    double synthetic_step_us_per_seq = 200.0;
+    size_t synthetic_kv_tokens = 16384;
+};
+
+/**
+ * @struct bench_request
+ * @brief One replayed prompt and the timestamps observed for it, in bench_now_ms time.
+ */
+struct bench_request {
+    size_t index = 0;
+    std::string prompt;
+    size_t input_tokens = 0;
+    size_t output_tokens = 0;
+    double arrival_ms = 0.0;
+    double first_token_ms = -1.0;
+    double end_ms = -1.0;
+    bool failed = false;
+    std::string error;
+};
+
+/**
+ * @struct bench_sample
+ * @brief One point of the resource timeline.
+ */
+struct bench_sample {
+    double time_ms;
+    size_t rss_bytes;
+    float kv_usage;
+    size_t in_flight;
+};
+
+/**
+ * @brief Milliseconds on the steady clock since the harness started.
+ */
+double bench_now_ms();
+
+/**
+ * @brief Resident set size of the process in bytes, 0 when the platform does not report it.
+ */
+size_t bench_rss_bytes();
+
+/**
+ * @brief Parses the command line.
+ * @return false with error set when an option is unknown or malformed.
+ */
+bool bench_parse_options(int argc, char* argv[], bench_options& options, std::string& error);
+
+/**
+ * @brief Prints the command line help.
+ */
+void bench_print_usage();
+
+/**
+ * @brief Loads the prompts, either one prompt per line or JSON lines with a "prompt" field.
+ * @return false with error set when the file cannot be read or holds no prompt.
+ */
+bool bench_load_dataset(const std::string& path, std::vector<std::string>& prompts, std::string& error);
+
+/**
+ * @brief Builds the JSON report of a finished run.
+ */
+std::string bench_report_json(const bench_options& options,
+    const char* backend_name,
+    const std::vector<bench_request>& requests,
+    const std::vector<bench_sample>& samples,
+    double duration_ms);
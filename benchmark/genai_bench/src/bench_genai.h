@@ -0,0 +1,71 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file bench_genai.h
+* @brief This is a header file for the helpers shared by the genai_bench backends built on the ov_genai C API.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/20
+*/
+
+#pragma once
+#include <stdexcept>
+#include <string>
+
+#include "bench_common.h"
+#include "ov_genai_continuous_batching_pipeline.h"
+#include "ov_genai_llm_pipeline.h"
+#include "ov_genai_perf_metrics.h"
+
+/**
+ * @brief The message of the last failed ov_genai call.
+ */
+inline std::string bench_genai_error(ov_status_e status) {
+    std::string message = ov_genai_get_error_info(status);
+    const char* detail = ov_genai_get_last_err_msg();
+    if (detail) {
+        message += ": ";
+        message += detail;
+        ov_genai_free(detail);
+    }
+    return message;
+}
+
+/**
+ * @brief Throws with the last error message when a setup call failed.
+ */
+inline void bench_genai_check(ov_status_e status, const char* what) {
+    if (status != ov_status_e::OK)
+        throw std::runtime_error(std::string(what) + " failed, " + bench_genai_error(status));
+}
+
+/**
+ * @brief Counts the tokens of a prompt with the tokenizer of the pipeline.
+ */
+inline size_t bench_genai_count_tokens(ov_genai_tokenizer_t* tokenizer, const std::string& prompt) {
+    ov_genai_tokenized_inputs_t* tokenized_inputs = nullptr;
+    bench_genai_check(ov_genai_tokenizer_encode_string(tokenizer, prompt.c_str(), &tokenized_inputs), "Tokenizer encode");
+    ov_tensor_t* input_ids = nullptr;
+    ov_status_e status = ov_genai_tokenized_inputs_get_input_ids(tokenized_inputs, &input_ids);
+    ov_genai_tokenized_inputs_free(tokenized_inputs);
+    bench_genai_check(status, "Get input ids");
+    // a single prompt encodes to a [1, tokens] tensor
+    size_t size = 0;
+    status = ov_tensor_get_size(input_ids, &size);
+    ov_tensor_free(input_ids);
+    bench_genai_check(status, "Get input ids size");
+    return size;
+}
+
+/**
+ * @brief Creates the sampling parameters every request of the run shares.
+ */
+inline ov_genai_generation_config_t* bench_genai_create_config(const bench_options& options) {
+    ov_genai_generation_config_t* config = nullptr;
+    bench_genai_check(ov_genai_generation_config_create(&config), "Create generation config");
+    bench_genai_check(ov_genai_generation_config_set_max_new_tokens(config, options.max_new_tokens), "Set max_new_tokens");
+    bench_genai_check(ov_genai_generation_config_set_ignore_eos(config, options.ignore_eos), "Set ignore_eos");
+    return config;
+}
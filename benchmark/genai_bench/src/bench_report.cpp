@@ -0,0 +1,143 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file bench_report.cpp
+* @brief This is a source file for the genai_bench JSON report.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/20
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+
+#include "bench_common.h"
+
+/**
+ * @brief Percentile with linear interpolation between the closest ranks, values must be sorted.
+ */
+static double percentile(const std::vector<double>& values, double p) {
+    if (values.empty())
+        return 0.0;
+    double rank = p / 100.0 * static_cast<double>(values.size() - 1);
+    size_t low = static_cast<size_t>(rank);
+    size_t high = std::min(low + 1, values.size() - 1);
+    return values[low] + (values[high] - values[low]) * (rank - static_cast<double>(low));
+}
+
+static void write_distribution(std::ostringstream& json, const char* name, std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    double mean = values.empty() ? 0.0 : std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+    json << "\"" << name << "\":{"
+        << "\"count\":" << values.size()
+        << ",\"mean\":" << mean
+        << ",\"p50\":" << percentile(values, 50.0)
+        << ",\"p90\":" << percentile(values, 90.0)
+        << ",\"p95\":" << percentile(values, 95.0)
+        << ",\"p99\":" << percentile(values, 99.0)
+        << ",\"max\":" << (values.empty() ? 0.0 : values.back())
+        << "}";
+}
+
+static std::string escape(const std::string& text) {
+    std::string escaped;
+    for (char c : text) {
+        switch (c) {
+        case '"': escaped += "\\\""; break;
+        case '\\': escaped += "\\\\"; break;
+        case '\n': escaped += "\\n"; break;
+        case '\r': escaped += "\\r"; break;
+        case '\t': escaped += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char buffer[8];
+                std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+                escaped += buffer;
+            }
+            else {
+                escaped.push_back(c);
+            }
+        }
+    }
+    return escaped;
+}
+
+std::string bench_report_json(const bench_options& options,
+    const char* backend_name,
+    const std::vector<bench_request>& requests,
+    const std::vector<bench_sample>& samples,
+    double duration_ms) {
+    std::vector<double> ttft, tpot, latency;
+    size_t failed = 0, input_tokens = 0, output_tokens = 0;
+    for (const auto& request : requests) {
+        if (request.failed) {
+            ++failed;
+            continue;
+        }
+        input_tokens += request.input_tokens;
+        output_tokens += request.output_tokens;
+        latency.push_back(request.end_ms - request.arrival_ms);
+        if (request.first_token_ms >= 0.0) {
+            ttft.push_back(request.first_token_ms - request.arrival_ms);
+            if (request.output_tokens > 1)
+                tpot.push_back((request.end_ms - request.first_token_ms) / (request.output_tokens - 1));
+        }
+    }
+    size_t peak_rss = 0;
+    for (const auto& sample : samples)
+        peak_rss = std::max(peak_rss, sample.rss_bytes);
+    double duration_s = duration_ms / 1000.0;
+
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(3);
+    json << "{\"config\":{"
+        << "\"backend\":\"" << backend_name << "\""
+        << ",\"model\":\"" << escape(options.model_path) << "\""
+        << ",\"device\":\"" << escape(options.device) << "\""
+        << ",\"dataset\":\"" << escape(options.dataset_path) << "\""
+        << ",\"load\":\"" << (options.load == bench_load_e::POISSON ? "poisson" : "closed") << "\""
+        << ",\"concurrency\":" << options.concurrency
+        << ",\"request_rate\":" << options.request_rate
+        << ",\"max_new_tokens\":" << options.max_new_tokens
+        << ",\"seed\":" << options.seed
+        << "},";
+    json << "\"summary\":{"
+        << "\"requests\":" << requests.size()
+        << ",\"failed\":" << failed
+        << ",\"duration_s\":" << duration_s
+        << ",\"input_tokens\":" << input_tokens
+        << ",\"output_tokens\":" << output_tokens
+        << ",\"request_throughput\":" << (duration_s > 0.0 ? (requests.size() - failed) / duration_s : 0.0)
+        << ",\"output_token_throughput\":" << (duration_s > 0.0 ? output_tokens / duration_s : 0.0)
+        << ",\"peak_rss_mb\":" << peak_rss / (1024.0 * 1024.0)
+        << "},";
+    write_distribution(json, "ttft_ms", ttft);
+    json << ",";
+    write_distribution(json, "tpot_ms", tpot);
+    json << ",";
+    write_distribution(json, "e2e_latency_ms", latency);
+    json << ",\"timeline\":[";
+    for (size_t i = 0; i < samples.size(); ++i) {
+        const auto& sample = samples[i];
+        json << (i ? "," : "")
+            << "{\"t_ms\":" << sample.time_ms
+            << ",\"rss_mb\":" << sample.rss_bytes / (1024.0 * 1024.0)
+            << ",\"kv_usage\":" << sample.kv_usage
+            << ",\"in_flight\":" << sample.in_flight << "}";
+    }
+    json << "],\"errors\":[";
+    bool first = true;
+    for (const auto& request : requests) {
+        if (!request.failed)
+            continue;
+        json << (first ? "" : ",") << "{\"request\":" << request.index << ",\"error\":\"" << escape(request.error) << "\"}";
+        first = false;
+    }
+    json << "]}";
+    return json.str();
+}
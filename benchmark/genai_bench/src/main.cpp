@@ -0,0 +1,200 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file main.cpp
+* @brief This is the entry of genai_bench, which replays a prompt dataset against a pipeline at a
+* configurable arrival rate and writes TTFT/TPOT percentiles, throughput, KV usage and RSS as JSON.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/20
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+#include "bench_backend.h"
+
+/**
+ * @class bench_sampler
+ * @brief Samples RSS on its own thread, so the timeline keeps going while a long generate call blocks the harness.
+ * KV usage and the number of requests in flight are published by the harness thread after every step.
+ */
+class bench_sampler {
+public:
+    explicit bench_sampler(double interval_ms)
+        : m_interval(interval_ms), m_thread([this] { run(); }) {}
+
+    ~bench_sampler() {
+        stop();
+    }
+
+    void publish(float kv_usage, size_t in_flight) {
+        m_kv_usage.store(kv_usage, std::memory_order_relaxed);
+        m_in_flight.store(in_flight, std::memory_order_relaxed);
+    }
+
+    std::vector<bench_sample> stop() {
+        if (m_thread.joinable()) {
+            m_running.store(false);
+            m_thread.join();
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_samples;
+    }
+
+private:
+    void run() {
+        while (m_running.load()) {
+            bench_sample sample{ bench_now_ms(), bench_rss_bytes(),
+                m_kv_usage.load(std::memory_order_relaxed), m_in_flight.load(std::memory_order_relaxed) };
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_samples.push_back(sample);
+            }
+            std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(m_interval));
+        }
+    }
+
+    double m_interval;
+    std::atomic<bool> m_running{ true };
+    std::atomic<float> m_kv_usage{ -1.0f };
+    std::atomic<size_t> m_in_flight{ 0 };
+    std::mutex m_mutex;
+    std::vector<bench_sample> m_samples;
+    std::thread m_thread;
+};
+
+static std::unique_ptr<bench_backend> create_backend(const bench_options& options) {
+    switch (options.backend) {
+    case bench_backend_e::LLM:
+        return bench_create_llm_backend(options);
+    case bench_backend_e::CONTINUOUS_BATCHING:
+        return bench_create_continuous_batching_backend(options);
+    default:
+        return bench_create_synthetic_backend(options);
+    }
+}
+
+/**
+ * @brief Sends the warmup requests one at a time, they are not part of the report.
+ */
+static void warmup(bench_backend& backend, const std::vector<bench_request>& requests, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        bench_request request = requests[i % requests.size()];
+        request.arrival_ms = bench_now_ms();
+        backend.submit(&request);
+        while (backend.in_flight() > 0)
+            backend.step();
+    }
+}
+
+/**
+ * @brief Replays the requests and returns the wall time of the run in milliseconds.
+ * The closed loop keeps concurrency requests in flight. The Poisson load submits every request
+ * at its scheduled arrival whatever the pipeline state, so queueing shows up in TTFT.
+ */
+static double replay(const bench_options& options, bench_backend& backend, std::vector<bench_request>& requests,
+    bench_sampler& sampler) {
+    std::vector<double> schedule(requests.size(), 0.0);
+    if (options.load == bench_load_e::POISSON) {
+        std::mt19937_64 generator(options.seed);
+        std::exponential_distribution<double> gap(options.request_rate / 1000.0);
+        double arrival = 0.0;
+        for (auto& time : schedule) {
+            time = arrival;
+            arrival += gap(generator);
+        }
+    }
+
+    double start = bench_now_ms();
+    size_t next = 0, completed = 0;
+    while (completed < requests.size()) {
+        double now = bench_now_ms();
+        if (options.load == bench_load_e::CLOSED_LOOP) {
+            while (next < requests.size() && backend.in_flight() < options.concurrency) {
+                requests[next].arrival_ms = now;
+                backend.submit(&requests[next++]);
+            }
+        }
+        else {
+            while (next < requests.size() && start + schedule[next] <= now) {
+                requests[next].arrival_ms = start + schedule[next];
+                backend.submit(&requests[next++]);
+            }
+        }
+
+        if (backend.in_flight() == 0) {
+            if (next >= requests.size())
+                break;
+            // idle until the next arrival, bounded so the loop stays responsive
+            double wait = std::min(start + schedule[next] - now, 1.0);
+            if (wait > 0.0)
+                std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(wait));
+            continue;
+        }
+        completed += backend.step();
+        sampler.publish(backend.kv_usage(), backend.in_flight());
+    }
+    return bench_now_ms() - start;
+}
+
+int main(int argc, char* argv[]) {
+    bench_options options;
+    std::string error;
+    if (argc < 2 || !bench_parse_options(argc, argv, options, error)) {
+        if (!error.empty())
+            std::fprintf(stderr, "%s\n", error.c_str());
+        bench_print_usage();
+        return 1;
+    }
+
+    std::vector<std::string> prompts;
+    if (!bench_load_dataset(options.dataset_path, prompts, error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    try {
+        std::unique_ptr<bench_backend> backend = create_backend(options);
+
+        size_t count = options.num_requests ? options.num_requests : prompts.size();
+        std::vector<bench_request> requests(count);
+        for (size_t i = 0; i < count; ++i) {
+            requests[i].index = i;
+            requests[i].prompt = prompts[i % prompts.size()];
+            requests[i].input_tokens = backend->count_tokens(requests[i].prompt);
+        }
+        warmup(*backend, requests, options.warmup);
+
+        bench_sampler sampler(options.sample_interval_ms);
+        double duration_ms = replay(options, *backend, requests, sampler);
+        std::vector<bench_sample> samples = sampler.stop();
+
+        std::string report = bench_report_json(options, backend->name(), requests, samples, duration_ms);
+        if (options.output_path.empty()) {
+            std::printf("%s\n", report.c_str());
+        }
+        else {
+            std::ofstream file(options.output_path, std::ios::out | std::ios::trunc);
+            if (!file.is_open()) {
+                std::fprintf(stderr, "Cannot open %s for writing\n", options.output_path.c_str());
+                return 1;
+            }
+            file << report << "\n";
+        }
+    }
+    catch (const std::exception& e) {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
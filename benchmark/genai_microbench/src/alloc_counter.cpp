@@ -0,0 +1,129 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file alloc_counter.cpp
+* @brief This is a source file replacing the global operator new and delete of genai_microbench with
+* counting versions. The wrapper sources are compiled into the executable instead of being loaded from
+* the DLL, since a DLL keeps the allocator it was linked with and its allocations would not be seen here.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/22
+*/
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "microbench.h"
+
+static std::atomic<size_t> alloc_count{ 0 };
+
+size_t microbench_alloc_count() {
+    return alloc_count.load(std::memory_order_relaxed);
+}
+
+#if defined(_MSC_VER)
+// Out of line so the optimizer cannot see that the pointer goes nowhere.
+__declspec(noinline) void microbench_escape(const void* pointer) {
+    static const void* volatile sink;
+    sink = pointer;
+}
+#endif
+
+static void* counted_alloc(size_t size) {
+    alloc_count.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+static void* counted_aligned_alloc(size_t size, std::align_val_t alignment) {
+    alloc_count.fetch_add(1, std::memory_order_relaxed);
+    size = size ? size : 1;
+#if defined(_MSC_VER)
+    return _aligned_malloc(size, static_cast<size_t>(alignment));
+#else
+    size_t align = static_cast<size_t>(alignment);
+    return std::aligned_alloc(align, (size + align - 1) / align * align);
+#endif
+}
+
+static void counted_aligned_free(void* pointer) {
+#if defined(_MSC_VER)
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+
+void* operator new(size_t size) {
+    if (void* pointer = counted_alloc(size))
+        return pointer;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    if (void* pointer = counted_alloc(size))
+        return pointer;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return counted_alloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return counted_alloc(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    if (void* pointer = counted_aligned_alloc(size, alignment))
+        return pointer;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    if (void* pointer = counted_aligned_alloc(size, alignment))
+        return pointer;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+    counted_aligned_free(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+    counted_aligned_free(pointer);
+}
+
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept {
+    counted_aligned_free(pointer);
+}
+
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept {
+    counted_aligned_free(pointer);
+}
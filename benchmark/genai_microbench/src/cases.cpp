@@ -0,0 +1,259 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file cases.cpp
+* @brief This is a source file for the genai_microbench cases. Each case runs a C API entry point and
+* the ov::genai code a C++ caller would write instead, on objects filled with synthetic data so that
+* no model is needed.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/22
+*/
+
+#include "microbench.h"
+
+#include "genai_common.h"
+#include "ov_genai_decoded_results.h"
+#include "ov_genai_generation_config.h"
+#include "ov_genai_perf_metrics.h"
+#include "ov_genai_raw_perf_metrics.h"
+
+// The sizes of a short chat request.
+static const size_t MOCK_PROMPTS = 8;
+static const size_t MOCK_TOKENS = 128;
+
+/**
+ * @brief DecodedResults of a MOCK_TOKENS long generation, with evaluated perf metrics.
+ */
+static std::shared_ptr<ov::genai::DecodedResults> mock_decoded_results() {
+    auto results = std::make_shared<ov::genai::DecodedResults>();
+    results->texts = { std::string(4 * MOCK_TOKENS, 'a') };
+    results->scores = { 0.0f };
+
+    ov::genai::RawPerfMetrics& raw = results->perf_metrics.raw_metrics;
+    auto start = std::chrono::steady_clock::now();
+    raw.generate_durations = { ov::genai::MicroSeconds(MOCK_TOKENS * 20000.0f) };
+    raw.tokenization_durations = { ov::genai::MicroSeconds(300.0f) };
+    raw.detokenization_durations = { ov::genai::MicroSeconds(900.0f) };
+    for (size_t i = 0; i < MOCK_TOKENS; ++i) {
+        raw.m_new_token_times.push_back(start + std::chrono::microseconds(50000 + 20000 * i));
+        raw.m_batch_sizes.push_back(1);
+        raw.m_durations.push_back(ov::genai::MicroSeconds(i == 0 ? 50000.0f : 20000.0f));
+    }
+    raw.m_times_to_first_token = { ov::genai::MicroSeconds(50000.0f) };
+    results->perf_metrics.num_input_tokens = 64;
+    results->perf_metrics.num_generated_tokens = MOCK_TOKENS;
+    results->perf_metrics.evaluate_statistics(start);
+    return results;
+}
+
+static ov_genai_decoded_results_t mock_decoded_results_handle() {
+    ov_genai_decoded_results_t handle;
+    handle.object = mock_decoded_results();
+    return handle;
+}
+
+static std::vector<std::string> mock_prompts() {
+    std::vector<std::string> prompts;
+    for (size_t i = 0; i < MOCK_PROMPTS; ++i)
+        prompts.push_back("Prompt " + std::to_string(i) + ", long enough to be kept out of the small string buffer.");
+    return prompts;
+}
+
+static generation_config_param_t mock_generation_config_param() {
+    generation_config_param_t param;
+    param.max_new_tokens = MOCK_TOKENS;
+    param.ignore_eos = true;
+    param.temperature = 0.7f;
+    param.top_p = 0.9f;
+    param.top_k = 40;
+    param.do_sample = true;
+    param.repetition_penalty = 1.1f;
+    return param;
+}
+
+// char_arrays_to_str_array: the prompt batch of ov_genai_llm_pipeline_generate_* and the CB generate calls.
+
+static void wrapper_char_arrays_to_str_array(microbench_state& state) {
+    std::vector<std::string> prompts = mock_prompts();
+    std::vector<char*> pointers;
+    for (auto& prompt : prompts)
+        pointers.push_back(prompt.data());
+    ov_genai_char_arrays_t arrays{ pointers.data(), pointers.size() };
+    for (auto _ : state) {
+        ov::genai::StringInputs inputs = char_arrays_to_str_array(arrays);
+        microbench_do_not_optimize(inputs);
+    }
+}
+
+static void direct_char_arrays_to_str_array(microbench_state& state) {
+    std::vector<std::string> prompts = mock_prompts();
+    for (auto _ : state) {
+        // generate takes StringInputs by value, a C++ caller pays for this copy too
+        ov::genai::StringInputs inputs = prompts;
+        microbench_do_not_optimize(inputs);
+    }
+}
+
+MICROBENCH_PAIR(char_arrays_to_str_array, wrapper_char_arrays_to_str_array, direct_char_arrays_to_str_array);
+
+// ov_genai_generation_config_update_generation_config: goes through generation_config_param_to_anymap.
+
+static void wrapper_generation_config_update(microbench_state& state) {
+    ov_genai_generation_config_t config;
+    config.object = std::make_shared<ov::genai::GenerationConfig>();
+    generation_config_param_t param = mock_generation_config_param();
+    for (auto _ : state) {
+        ov_status_e status = ov_genai_generation_config_update_generation_config(&config, &param);
+        microbench_do_not_optimize(status);
+    }
+}
+
+static void direct_generation_config_update(microbench_state& state) {
+    ov::genai::GenerationConfig config;
+    generation_config_param_t param = mock_generation_config_param();
+    for (auto _ : state) {
+        config.max_new_tokens = param.max_new_tokens;
+        config.max_length = param.max_length;
+        config.ignore_eos = param.ignore_eos;
+        config.num_beam_groups = param.num_beam_groups;
+        config.num_beams = param.num_beams;
+        config.diversity_penalty = param.diversity_penalty;
+        config.length_penalty = param.length_penalty;
+        config.num_return_sequences = param.num_return_sequences;
+        config.no_repeat_ngram_size = param.no_repeat_ngram_size;
+        config.stop_criteria = static_cast<ov::genai::StopCriteria>(param.stop_criteria);
+        config.temperature = param.temperature;
+        config.top_p = param.top_p;
+        config.top_k = param.top_k;
+        config.do_sample = param.do_sample;
+        config.repetition_penalty = param.repetition_penalty;
+        config.eos_token_id = param.eos_token_id;
+        config.validate();
+        microbench_do_not_optimize(config);
+    }
+}
+
+MICROBENCH_PAIR(generation_config_update, wrapper_generation_config_update, direct_generation_config_update);
+
+// ov_genai_generation_config_get_max_new_tokens: the cost of the status code and the try block alone.
+
+static void wrapper_generation_config_get_max_new_tokens(microbench_state& state) {
+    ov_genai_generation_config_t config;
+    config.object = std::make_shared<ov::genai::GenerationConfig>();
+    for (auto _ : state) {
+        size_t max_new_tokens = 0;
+        ov_genai_generation_config_get_max_new_tokens(&config, &max_new_tokens);
+        microbench_do_not_optimize(max_new_tokens);
+    }
+}
+
+static void direct_generation_config_get_max_new_tokens(microbench_state& state) {
+    auto config = std::make_shared<ov::genai::GenerationConfig>();
+    for (auto _ : state) {
+        size_t max_new_tokens = config->max_new_tokens;
+        microbench_do_not_optimize(max_new_tokens);
+    }
+}
+
+MICROBENCH_PAIR(generation_config_get_max_new_tokens, wrapper_generation_config_get_max_new_tokens,
+    direct_generation_config_get_max_new_tokens);
+
+// ov_genai_decoded_results_get_perf_metrics + ov_genai_get_ttft: a result getter that allocates a wrapper.
+
+static void wrapper_decoded_results_get_ttft(microbench_state& state) {
+    ov_genai_decoded_results_t results = mock_decoded_results_handle();
+    for (auto _ : state) {
+        ov_genai_perf_metrics_t* perf_metrics = nullptr;
+        ov_genai_mean_std_pair_t ttft{};
+        ov_genai_decoded_results_get_perf_metrics(&results, &perf_metrics);
+        ov_genai_get_ttft(perf_metrics, &ttft);
+        ov_genai_perf_metrics_free(perf_metrics);
+        microbench_do_not_optimize(ttft);
+    }
+}
+
+static void direct_decoded_results_get_ttft(microbench_state& state) {
+    auto results = mock_decoded_results();
+    for (auto _ : state) {
+        ov::genai::MeanStdPair ttft = results->perf_metrics.get_ttft();
+        microbench_do_not_optimize(ttft);
+    }
+}
+
+MICROBENCH_PAIR(decoded_results_get_ttft, wrapper_decoded_results_get_ttft, direct_decoded_results_get_ttft);
+
+// ov_genai_raw_perf_metrics_get_m_durations: copies the series into a new float array.
+
+static void wrapper_raw_perf_metrics_get_m_durations(microbench_state& state) {
+    ov_genai_decoded_results_t results = mock_decoded_results_handle();
+    ov_genai_perf_metrics_t* perf_metrics = nullptr;
+    ov_genai_raw_perf_metrics_t* raw_perf_metrics = nullptr;
+    ov_genai_decoded_results_get_perf_metrics(&results, &perf_metrics);
+    ov_genai_perf_metrics_get_raw_metrics(perf_metrics, &raw_perf_metrics);
+    for (auto _ : state) {
+        float* durations = nullptr;
+        size_t length = 0;
+        ov_genai_raw_perf_metrics_get_m_durations(raw_perf_metrics, &durations, &length);
+        microbench_do_not_optimize(durations[length - 1]);
+        delete[] durations;
+    }
+    ov_genai_raw_perf_metrics_free(raw_perf_metrics);
+    ov_genai_perf_metrics_free(perf_metrics);
+}
+
+static void direct_raw_perf_metrics_m_durations(microbench_state& state) {
+    auto results = mock_decoded_results();
+    for (auto _ : state) {
+        const auto& durations = results->perf_metrics.raw_metrics.m_durations;
+        microbench_do_not_optimize(durations.back().count());
+    }
+}
+
+MICROBENCH_PAIR(raw_perf_metrics_get_m_durations, wrapper_raw_perf_metrics_get_m_durations,
+    direct_raw_perf_metrics_m_durations);
+
+// ov_genai_raw_perf_metrics_get_durations_view: the borrowed view of the same series.
+
+static void wrapper_raw_perf_metrics_durations_view(microbench_state& state) {
+    ov_genai_decoded_results_t results = mock_decoded_results_handle();
+    ov_genai_perf_metrics_t* perf_metrics = nullptr;
+    ov_genai_raw_perf_metrics_t* raw_perf_metrics = nullptr;
+    ov_genai_decoded_results_get_perf_metrics(&results, &perf_metrics);
+    ov_genai_perf_metrics_get_raw_metrics(perf_metrics, &raw_perf_metrics);
+    for (auto _ : state) {
+        const float* durations = nullptr;
+        size_t length = 0;
+        ov_genai_raw_perf_metrics_get_durations_view(raw_perf_metrics, RAW_DURATIONS, &durations, &length);
+        microbench_do_not_optimize(durations[length - 1]);
+    }
+    ov_genai_raw_perf_metrics_free(raw_perf_metrics);
+    ov_genai_perf_metrics_free(perf_metrics);
+}
+
+MICROBENCH_PAIR(raw_perf_metrics_durations_view, wrapper_raw_perf_metrics_durations_view,
+    direct_raw_perf_metrics_m_durations);
+
+// ov_genai_decoded_results_get_texts: formats the results into a new C string.
+
+static void wrapper_decoded_results_get_texts(microbench_state& state) {
+    ov_genai_decoded_results_t results = mock_decoded_results_handle();
+    for (auto _ : state) {
+        char* texts = nullptr;
+        ov_genai_decoded_results_get_texts(&results, &texts);
+        microbench_do_not_optimize(texts[0]);
+        ov_genai_free(texts);
+    }
+}
+
+static void direct_decoded_results_texts(microbench_state& state) {
+    auto results = mock_decoded_results();
+    for (auto _ : state) {
+        const std::string& text = results->texts[0];
+        microbench_do_not_optimize(text[0]);
+    }
+}
+
+MICROBENCH_PAIR(decoded_results_get_texts, wrapper_decoded_results_get_texts, direct_decoded_results_texts);
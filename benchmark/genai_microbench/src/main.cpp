@@ -0,0 +1,132 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file main.cpp
+* @brief This is the entry of genai_microbench, which reports the time and allocations each ov_genai
+* C entry point adds over the direct ov::genai call, and fails when they regress past the baseline.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/22
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#include "microbench.h"
+
+static void print_usage() {
+    std::printf(
+        "Usage: genai_microbench [options]\n"
+        "  --filter <text>          Run only the cases whose name contains text\n"
+        "  --min-time-ms <ms>       Minimum time of one repetition, default 200\n"
+        "  --repetitions <n>        Repetitions, the median is reported, default 5\n"
+        "  --json <file>            Write the results as JSON\n"
+        "  --baseline <file>        Baseline written by --save-baseline\n"
+        "  --save-baseline          Overwrite the baseline with the results of this run\n"
+        "  --check                  Exit with 1 when a case regresses or the baseline is missing\n"
+        "  --time-tolerance <r>     Allowed relative growth of the overhead, default 0.25\n"
+        "  --time-slack-ns <ns>     Allowed absolute growth of the overhead, default 20\n");
+}
+
+static bool parse_options(int argc, char* argv[], microbench_options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string name = argv[i];
+        if (name == "--save-baseline") {
+            options.save_baseline = true;
+            continue;
+        }
+        if (name == "--check") {
+            options.check = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            std::fprintf(stderr, "Missing value of %s\n", name.c_str());
+            return false;
+        }
+        const char* value = argv[++i];
+        if (name == "--filter")
+            options.filter = value;
+        else if (name == "--min-time-ms")
+            options.min_time_ms = std::atof(value);
+        else if (name == "--repetitions")
+            options.repetitions = std::strtoull(value, nullptr, 10);
+        else if (name == "--json")
+            options.json_path = value;
+        else if (name == "--baseline")
+            options.baseline_path = value;
+        else if (name == "--time-tolerance")
+            options.time_tolerance = std::atof(value);
+        else if (name == "--time-slack-ns")
+            options.time_slack_ns = std::atof(value);
+        else {
+            std::fprintf(stderr, "Unknown option %s\n", name.c_str());
+            return false;
+        }
+    }
+    if (options.save_baseline && options.baseline_path.empty()) {
+        std::fprintf(stderr, "--save-baseline needs --baseline\n");
+        return false;
+    }
+    return true;
+}
+
+static bool write_file(const std::string& path, const std::string& text) {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        std::fprintf(stderr, "Cannot open %s for writing\n", path.c_str());
+        return false;
+    }
+    file << text;
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    microbench_options options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage();
+        return 1;
+    }
+
+    std::printf("%-40s %12s %12s %12s %10s %10s\n", "case", "wrapper ns", "direct ns", "overhead ns",
+        "w allocs", "d allocs");
+    std::vector<microbench_result> results;
+    for (const auto& bench_case : microbench_cases()) {
+        if (!options.filter.empty() && std::strstr(bench_case.name, options.filter.c_str()) == nullptr)
+            continue;
+        microbench_result result = microbench_run(bench_case, options);
+        if (result.error.empty())
+            std::printf("%-40s %12.2f %12.2f %12.2f %10.2f %10.2f\n", result.name.c_str(), result.wrapper_ns,
+                result.direct_ns, result.overhead_ns(), result.wrapper_allocs, result.direct_allocs);
+        else
+            std::printf("%-40s error: %s\n", result.name.c_str(), result.error.c_str());
+        results.push_back(result);
+    }
+
+    std::string json = microbench_results_json(results);
+    if (!options.json_path.empty() && !write_file(options.json_path, json))
+        return 1;
+    if (options.save_baseline)
+        return write_file(options.baseline_path, json) ? 0 : 1;
+
+    if (options.check) {
+        std::vector<microbench_result> baseline;
+        std::string error;
+        if (options.baseline_path.empty() || !microbench_load_baseline(options.baseline_path, baseline, error)) {
+            // a check without a baseline checks nothing, fail so the build does not pass silently
+            std::fprintf(stderr, "%s, record one with --save-baseline\n",
+                error.empty() ? "--check needs --baseline" : error.c_str());
+            return 1;
+        }
+        size_t failures = microbench_check(results, baseline, options);
+        if (failures > 0) {
+            std::fprintf(stderr, "%zu regression(s) against %s\n", failures, options.baseline_path.c_str());
+            return 1;
+        }
+        std::printf("No regression against %s\n", options.baseline_path.c_str());
+    }
+    return 0;
+}
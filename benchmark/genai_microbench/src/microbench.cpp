@@ -0,0 +1,174 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file microbench.cpp
+* @brief This is a source file for the genai_microbench runner, baseline file and regression check.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/22
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "microbench.h"
+
+std::vector<microbench_case>& microbench_cases() {
+    static std::vector<microbench_case> cases;
+    return cases;
+}
+
+int microbench_register(const char* name, microbench_function wrapper, microbench_function direct) {
+    microbench_cases().push_back({ name, wrapper, direct });
+    return 0;
+}
+
+struct side_result {
+    double ns = 0.0;
+    double allocs = 0.0;
+    std::string error;
+};
+
+static side_result measure(microbench_function function, const microbench_options& options) {
+    side_result result;
+    // grow the iteration count until one run lasts min_time_ms
+    size_t iterations = 1;
+    double min_time_ns = options.min_time_ms * 1e6;
+    for (;;) {
+        microbench_state state(iterations);
+        function(state);
+        if (!state.error().empty()) {
+            result.error = state.error();
+            return result;
+        }
+        if (state.elapsed_ns() >= min_time_ns || iterations >= (size_t(1) << 40))
+            break;
+        double scale = state.elapsed_ns() > 0.0 ? 1.4 * min_time_ns / state.elapsed_ns() : 100.0;
+        iterations = static_cast<size_t>(static_cast<double>(iterations) * std::clamp(scale, 2.0, 100.0));
+    }
+
+    std::vector<double> times;
+    size_t allocations = 0;
+    for (size_t i = 0; i < std::max<size_t>(options.repetitions, 1); ++i) {
+        microbench_state state(iterations);
+        function(state);
+        times.push_back(state.elapsed_ns() / static_cast<double>(iterations));
+        allocations = state.allocations();
+    }
+    std::sort(times.begin(), times.end());
+    result.ns = times[times.size() / 2];
+    result.allocs = static_cast<double>(allocations) / static_cast<double>(iterations);
+    return result;
+}
+
+microbench_result microbench_run(const microbench_case& bench_case, const microbench_options& options) {
+    microbench_result result;
+    result.name = bench_case.name;
+    side_result direct = measure(bench_case.direct, options);
+    side_result wrapper = measure(bench_case.wrapper, options);
+    result.direct_ns = direct.ns;
+    result.direct_allocs = direct.allocs;
+    result.wrapper_ns = wrapper.ns;
+    result.wrapper_allocs = wrapper.allocs;
+    result.error = !wrapper.error.empty() ? wrapper.error : direct.error;
+    return result;
+}
+
+std::string microbench_results_json(const std::vector<microbench_result>& results) {
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(2);
+    json << "[\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& result = results[i];
+        json << "{\"name\":\"" << result.name << "\""
+            << ",\"wrapper_ns\":" << result.wrapper_ns
+            << ",\"direct_ns\":" << result.direct_ns
+            << ",\"overhead_ns\":" << result.overhead_ns()
+            << ",\"wrapper_allocs\":" << result.wrapper_allocs
+            << ",\"direct_allocs\":" << result.direct_allocs;
+        if (!result.error.empty())
+            json << ",\"error\":\"" << result.error << "\"";
+        json << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    json << "]\n";
+    return json.str();
+}
+
+static bool find_string(const std::string& line, const char* key, std::string& value) {
+    std::string pattern = std::string("\"") + key + "\":\"";
+    size_t begin = line.find(pattern);
+    if (begin == std::string::npos)
+        return false;
+    begin += pattern.size();
+    size_t end = line.find('"', begin);
+    if (end == std::string::npos)
+        return false;
+    value = line.substr(begin, end - begin);
+    return true;
+}
+
+static double find_number(const std::string& line, const char* key) {
+    std::string pattern = std::string("\"") + key + "\":";
+    size_t begin = line.find(pattern);
+    if (begin == std::string::npos)
+        return 0.0;
+    return std::strtod(line.c_str() + begin + pattern.size(), nullptr);
+}
+
+bool microbench_load_baseline(const std::string& path, std::vector<microbench_result>& baseline, std::string& error) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        error = "Cannot open baseline " + path;
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        microbench_result result;
+        if (!find_string(line, "name", result.name))
+            continue;
+        result.wrapper_ns = find_number(line, "wrapper_ns");
+        result.direct_ns = find_number(line, "direct_ns");
+        result.wrapper_allocs = find_number(line, "wrapper_allocs");
+        result.direct_allocs = find_number(line, "direct_allocs");
+        baseline.push_back(result);
+    }
+    return true;
+}
+
+size_t microbench_check(const std::vector<microbench_result>& results,
+    const std::vector<microbench_result>& baseline,
+    const microbench_options& options) {
+    size_t failures = 0;
+    for (const auto& result : results) {
+        if (!result.error.empty()) {
+            std::fprintf(stderr, "FAIL %s: %s\n", result.name.c_str(), result.error.c_str());
+            ++failures;
+            continue;
+        }
+        auto recorded = std::find_if(baseline.begin(), baseline.end(),
+            [&](const microbench_result& item) { return item.name == result.name; });
+        if (recorded == baseline.end()) {
+            std::fprintf(stderr, "NEW  %s: not in the baseline, record it with --save-baseline\n", result.name.c_str());
+            continue;
+        }
+        // allocation counts are exact, any additional allocation per call is a regression
+        if (result.wrapper_allocs > recorded->wrapper_allocs + 0.01) {
+            std::fprintf(stderr, "FAIL %s: %.2f allocations per call, baseline %.2f\n",
+                result.name.c_str(), result.wrapper_allocs, recorded->wrapper_allocs);
+            ++failures;
+        }
+        double limit = std::max(recorded->overhead_ns(), 0.0) * (1.0 + options.time_tolerance) + options.time_slack_ns;
+        if (result.overhead_ns() > limit) {
+            std::fprintf(stderr, "FAIL %s: %.2f ns overhead per call, baseline %.2f, limit %.2f\n",
+                result.name.c_str(), result.overhead_ns(), recorded->overhead_ns(), limit);
+            ++failures;
+        }
+    }
+    return failures;
+}
@@ -0,0 +1,218 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file microbench.h
+* @brief This is a header file for genai_microbench, a small Google Benchmark style framework that times
+* each ov_genai C entry point against the direct ov::genai call on mocked objects and counts the heap
+* allocations made per call.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/22
+*/
+
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Number of operator new calls made by the process so far, counted by alloc_counter.cpp.
+ */
+size_t microbench_alloc_count();
+
+#if defined(_MSC_VER)
+void microbench_escape(const void* pointer);
+#endif
+
+/**
+ * @brief Keeps the compiler from dropping the computation of value, the same as benchmark::DoNotOptimize.
+ */
+template <typename T>
+inline void microbench_do_not_optimize(T const& value) {
+#if defined(_MSC_VER)
+    microbench_escape(&value);
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "g"(&value) : "memory");
+#endif
+}
+
+/**
+ * @class microbench_state
+ * @brief Drives the timed loop of one benchmark function, written as `for (auto _ : state)`.
+ * The clock and the allocation counter start at the first iteration and stop after the last one,
+ * so the setup before the loop is not measured.
+ */
+class microbench_state {
+public:
+    struct value {};
+
+    class iterator {
+    public:
+        iterator(microbench_state* state, size_t remaining)
+            : m_state(state), m_remaining(remaining) {}
+
+        value operator*() const {
+            return {};
+        }
+
+        iterator& operator++() {
+            --m_remaining;
+            return *this;
+        }
+
+        bool operator!=(const iterator&) {
+            if (m_remaining != 0)
+                return true;
+            m_state->finish();
+            return false;
+        }
+
+    private:
+        microbench_state* m_state;
+        size_t m_remaining;
+    };
+
+    explicit microbench_state(size_t iterations)
+        : m_iterations(iterations) {}
+
+    iterator begin() {
+        m_allocs = microbench_alloc_count();
+        m_start = std::chrono::steady_clock::now();
+        return iterator(this, m_iterations);
+    }
+
+    iterator end() {
+        return iterator(this, 0);
+    }
+
+    size_t iterations() const {
+        return m_iterations;
+    }
+
+    double elapsed_ns() const {
+        return m_elapsed_ns;
+    }
+
+    size_t allocations() const {
+        return m_allocs;
+    }
+
+    /**
+     * @brief Marks the run as failed, the case is reported as an error and fails --check.
+     */
+    void skip_with_error(const std::string& error) {
+        m_error = error;
+    }
+
+    const std::string& error() const {
+        return m_error;
+    }
+
+private:
+    void finish() {
+        auto stop = std::chrono::steady_clock::now();
+        m_allocs = microbench_alloc_count() - m_allocs;
+        m_elapsed_ns = std::chrono::duration<double, std::nano>(stop - m_start).count();
+    }
+
+    size_t m_iterations;
+    std::chrono::steady_clock::time_point m_start;
+    double m_elapsed_ns = 0.0;
+    size_t m_allocs = 0;
+    std::string m_error;
+};
+
+typedef void (*microbench_function)(microbench_state& state);
+
+/**
+ * @struct microbench_case
+ * @brief A C API entry point and the C++ code it stands for, measured side by side.
+ */
+struct microbench_case {
+    const char* name;
+    microbench_function wrapper;
+    microbench_function direct;
+};
+
+/**
+ * @brief The cases registered with MICROBENCH_PAIR, in registration order.
+ */
+std::vector<microbench_case>& microbench_cases();
+
+/**
+ * @brief Registers a case, used through MICROBENCH_PAIR.
+ */
+int microbench_register(const char* name, microbench_function wrapper, microbench_function direct);
+
+#define MICROBENCH_PAIR(name, wrapper, direct) \
+    static const int microbench_registered_##name = microbench_register(#name, wrapper, direct)
+
+/**
+ * @struct microbench_options
+ * @brief Command line options of genai_microbench.
+ */
+struct microbench_options {
+    std::string filter;
+    double min_time_ms = 200.0;
+    size_t repetitions = 5;
+    std::string json_path;
+    std::string baseline_path;
+    bool save_baseline = false;
+    bool check = false;
+    // a case regresses when its overhead exceeds baseline * (1 + time_tolerance) + time_slack_ns
+    double time_tolerance = 0.25;
+    double time_slack_ns = 20.0;
+};
+
+/**
+ * @struct microbench_result
+ * @brief Median time per call and allocations per call of both sides of a case.
+ */
+struct microbench_result {
+    std::string name;
+    double wrapper_ns = 0.0;
+    double direct_ns = 0.0;
+    double wrapper_allocs = 0.0;
+    double direct_allocs = 0.0;
+    std::string error;
+
+    double overhead_ns() const {
+        return wrapper_ns - direct_ns;
+    }
+};
+
+/**
+ * @brief Runs one case, calibrating the iteration count to min_time_ms and keeping the median of the repetitions.
+ */
+microbench_result microbench_run(const microbench_case& bench_case, const microbench_options& options);
+
+/**
+ * @brief Writes the results as JSON, one case per line so the baseline can be read back without a JSON parser.
+ */
+std::string microbench_results_json(const std::vector<microbench_result>& results);
+
+/**
+ * @brief Reads a file written by microbench_results_json.
+ * @return false with error set when the file cannot be read.
+ */
+bool microbench_load_baseline(const std::string& path, std::vector<microbench_result>& baseline, std::string& error);
+
+/**
+ * @brief Compares the results with the baseline and prints every regression.
+ * A case regresses when the wrapper allocates more per call than recorded, or when its overhead over
+ * the direct call grows past the tolerance. Comparing the overhead rather than the absolute time keeps
+ * the check stable when the whole machine is slower or faster.
+ * @return The number of regressed or failed cases.
+ */
+size_t microbench_check(const std::vector<microbench_result>& results,
+    const std::vector<microbench_result>& baseline,
+    const microbench_options& options);
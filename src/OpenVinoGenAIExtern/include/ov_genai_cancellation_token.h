@@ -0,0 +1,68 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file ov_genai_cancellation_token.h
+* @brief This is a header file for the ov_genai_cancellation_token C API, a flag which stops the
+* generations it is attached to between two decode steps.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/24
+*/
+
+
+#pragma once
+#include "ov_genai_common.h"
+
+/**
+* @struct ov_genai_cancellation_token_t
+* @brief A flag set by the caller, read between the decode steps of the generations it is attached to.
+*/
+typedef struct ov_genai_cancellation_token ov_genai_cancellation_token_t;
+
+/**
+ * @brief Constructs a token which is not cancelled.
+ * @ingroup ov_genai_cancellation_token_c_api
+ * @param cancellation_token A pointer to the newly created ov_genai_cancellation_token_t.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_cancellation_token_create(ov_genai_cancellation_token_t** cancellation_token);
+
+/**
+ * @brief Release the memory allocated by ov_genai_cancellation_token_t. A pipeline the token is
+ * attached to keeps the flag alive.
+ * @ingroup ov_genai_cancellation_token_c_api
+ * @param cancellation_token A pointer to the ov_genai_cancellation_token_t to free memory.
+ */
+OPENVINO_C_API(void)
+ov_genai_cancellation_token_free(ov_genai_cancellation_token_t* cancellation_token);
+
+/**
+ * @brief Cancels the token, from any thread. The running generations stop before their next token.
+ * @ingroup ov_genai_cancellation_token_c_api
+ * @param cancellation_token A pointer to ov_genai_cancellation_token_t.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_cancellation_token_cancel(ov_genai_cancellation_token_t* cancellation_token);
+
+/**
+ * @brief Clears the flag, so the token can be used for the next generation.
+ * @ingroup ov_genai_cancellation_token_c_api
+ * @param cancellation_token A pointer to ov_genai_cancellation_token_t.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_cancellation_token_reset(ov_genai_cancellation_token_t* cancellation_token);
+
+/**
+ * @brief Gets whether the token is cancelled.
+ * @ingroup ov_genai_cancellation_token_c_api
+ * @param cancellation_token A pointer to ov_genai_cancellation_token_t.
+ * @param cancelled Set to true when the token is cancelled.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_cancellation_token_is_cancelled(const ov_genai_cancellation_token_t* cancellation_token, bool* cancelled);
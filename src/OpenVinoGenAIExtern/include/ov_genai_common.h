@@ -97,6 +97,122 @@ typedef enum {
     UNKNOW_EXCEPTION = -17,        //!< UNKNOW_EXCEPTION
 } ov_status_e;
 
+/**
+ * @enum ov_genai_try_status_e
+ * @ingroup ov_base_c_api
+ * @brief The outcome of the try_ functions. The conditions expected while serving requests are reported
+ * here without an exception or an error message, the function itself returns OK. Real failures are still
+ * returned as ov_status_e codes.
+ */
+typedef enum {
+    TRY_OK = 0,          //!< The operation was done.
+    TRY_QUEUE_FULL = 1,  //!< The pipeline takes no more requests for now, retry after a step.
+    TRY_NO_DATA = 2,     //!< The request is running and has no output ready yet.
+    TRY_FINISHED = 3,    //!< The request has finished and all of its output has been read.
+    TRY_DROPPED = 4,     //!< The request was dropped, by its handle or by the pipeline.
+    TRY_IDLE = 5,        //!< The pipeline has no request left to step.
+} ov_genai_try_status_e;
+
+/**
+ * @struct ov_genai_completion_cache_config_t
+ * @ingroup ov_base_c_api
+ * @brief Bounds of a completion cache, which replays the outputs of greedy requests seen before.
+ * The entries are kept in memory, least recently used first out, and optionally in a memory mapped file
+ * which outlives the process. The file holds the outputs of the model named in its header, a file of another
+ * model is refused, and it is locked by the cache which opened it, a second one fails to open it.
+ */
+typedef struct {
+    // Maximum number of entries in memory, 0 for no limit
+    size_t max_entries;
+    // Maximum size of the entries in memory in bytes, 0 for no limit
+    size_t max_bytes;
+    // The file of the mapped tier, NULL to keep the entries in memory only
+    const char* disk_path;
+    // Size of the file in bytes, the tier starts over when it is full
+    size_t disk_size;
+    // Identity of the model, its path for instance, part of every key; required with disk_path
+    const char* model_id;
+} ov_genai_completion_cache_config_t;
+
+/**
+ * @struct ov_genai_completion_cache_stats_t
+ * @ingroup ov_base_c_api
+ * @brief Counters of a completion cache.
+ */
+typedef struct {
+    // Lookups served from memory
+    uint64_t hits;
+    // Lookups served from the mapped file
+    uint64_t disk_hits;
+    // Lookups that found nothing
+    uint64_t misses;
+    // Entries in memory
+    size_t entries;
+    // Size of the entries in memory in bytes
+    size_t bytes;
+} ov_genai_completion_cache_stats_t;
+
+/**
+ * @struct ov_genai_chat_sessions_config_t
+ * @ingroup ov_base_c_api
+ * @brief Bounds of the chat sessions of a pipeline. A session keeps the messages of one conversation by id, the
+ * least recently used first out of memory into a snapshot file. Without a directory for them the messages stay in
+ * memory and only the KV cache of a session is dropped.
+ */
+typedef struct {
+    // Maximum number of sessions in memory when there is a snapshot_dir, 0 for no limit
+    size_t max_sessions;
+    // How long a session holding the KV cache of the pipeline stays idle before it is dropped, 0 for ever
+    size_t idle_ms;
+    // The directory of the snapshot files of the sessions out of memory, NULL to keep every session in memory
+    const char* snapshot_dir;
+} ov_genai_chat_sessions_config_t;
+
+/**
+ * @struct ov_genai_chat_sessions_stats_t
+ * @ingroup ov_base_c_api
+ * @brief Counters of the chat sessions of a pipeline.
+ */
+typedef struct {
+    // Sessions in memory
+    size_t sessions;
+    // Sessions holding the KV cache of the pipeline
+    size_t resident;
+    // Turns answered in a session
+    uint64_t turns;
+    // KV caches of idle or least recently used sessions dropped
+    uint64_t evictions;
+    // Turns which prefilled the whole history of their session again
+    uint64_t re_prefills;
+    // Sessions written to a snapshot file on their way out of memory
+    uint64_t snapshots_written;
+    // Sessions read back from a snapshot file
+    uint64_t snapshots_restored;
+} ov_genai_chat_sessions_stats_t;
+
+/**
+ * @struct ov_genai_speculative_metrics_t
+ * @ingroup ov_base_c_api
+ * @brief Acceptance counters of a pipeline decoding speculatively, with a draft model or by prompt lookup.
+ */
+typedef struct {
+    // Generations counted
+    uint64_t generations;
+    // Inferences of the main model, each one validating the draft tokens of the step
+    uint64_t steps;
+    // Tokens generated
+    uint64_t generated_tokens;
+    // Draft tokens proposed, counted for the generations with num_assistant_tokens only. With prompt lookup it is
+    // the upper bound, a step whose n-gram is not found in the prompt proposes fewer
+    uint64_t draft_tokens_proposed;
+    // Draft tokens the main model accepted
+    uint64_t draft_tokens_accepted;
+    // Accepted draft tokens per proposed one, 0 when none was counted
+    float acceptance_rate;
+    // Tokens generated per inference of the main model, 1 without speculation
+    float tokens_per_step;
+} ov_genai_speculative_metrics_t;
+
 /**
  * @enum ov_element_type_e
  * @ingroup ov_base_c_api
@@ -143,9 +259,21 @@ OPENVINO_C_API(void)
 ov_genai_free(const char* content);
 
 /**
- * @brief Get the last error msg.
+ * @brief Get the last error msg of the calling thread, as a copy released with ov_genai_free.
  * @ingroup ov_base_c_api
  */
 OPENVINO_C_API(const char*)
 ov_genai_get_last_err_msg();
 
+/**
+ * @brief Get the last error of the calling thread without copying it.
+ * @ingroup ov_base_c_api
+ * @param status The status code the failing call returned, OK when the thread has no error. May be NULL.
+ * @param msg The NUL terminated message, empty when the thread has no error. It is owned by the library
+ * and valid until the next failing call on the same thread.
+ * @param length The length of msg in bytes. May be NULL.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_get_last_err_msg_view(ov_status_e* status, const char** msg, size_t* length);
+
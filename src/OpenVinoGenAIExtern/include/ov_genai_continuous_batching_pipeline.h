@@ -32,6 +32,80 @@ typedef struct {
     float cache_usage;
 } ov_genai_pipeline_metrics_t;
 
+/**
+ * @struct ov_genai_admission_config_t
+ * @brief Limits of the admission control of a pipeline. A queued request is one admitted which has not
+ * produced its first token yet. 0 disables a limit.
+ */
+typedef struct {
+    // Maximum number of queued requests
+    size_t max_queued_requests;
+    // Maximum number of prompt tokens of the queued requests
+    size_t max_queued_prompt_tokens;
+    // KV cache usage in percent from which no request is admitted
+    float max_cache_usage;
+} ov_genai_admission_config_t;
+
+/**
+ * @struct ov_genai_admission_state_t
+ * @brief The load the admission control of a pipeline sees.
+ */
+typedef struct {
+    // Number of queued requests
+    size_t queued_requests;
+    // Number of prompt tokens of the queued requests
+    size_t queued_prompt_tokens;
+    // Percentage of KV cache usage
+    float cache_usage;
+    // Suggested wait before a rejected request is sent again, 0 until the pipeline has stepped
+    uint64_t retry_after_ms;
+} ov_genai_admission_state_t;
+
+/**
+ * @struct ov_genai_request_scheduler_config_t
+ * @brief Limits of the scheduler releasing the requests added with options into the steps. 0 disables a limit.
+ */
+typedef struct {
+    // Maximum number of released requests still running
+    size_t max_running_requests;
+    // KV cache usage in percent from which no request is released
+    float max_cache_usage;
+    // Non-zero to preempt a running request of lower priority for the head of the queue when there is no room
+    int preemption;
+} ov_genai_request_scheduler_config_t;
+
+/**
+ * @struct ov_genai_request_options_t
+ * @brief How a request added with options is ordered by the scheduler.
+ */
+typedef struct {
+    // Requests of higher priority are released first
+    int32_t priority;
+    // Milliseconds from now by which the request should be released, the earliest first within a priority, 0 for none
+    uint64_t deadline_ms;
+    // The tenant sharing the tokens of the pipeline with the others by its weight, NULL for the default tenant
+    const char* tenant;
+} ov_genai_request_options_t;
+
+/**
+ * @struct ov_genai_tenant_metrics_t
+ * @brief Metrics of one tenant of the request scheduler.
+ */
+typedef struct {
+    // Requests of the tenant waiting in the queue
+    size_t queued_requests;
+    // Requests of the tenant released and still running
+    size_t running_requests;
+    // Requests of the tenant finished or dropped after their release
+    uint64_t requests_served;
+    // Prompt tokens released plus generated tokens read, the share the weight applies to
+    uint64_t tokens_served;
+    // Moving average of the time from the add to the release, in milliseconds
+    float avg_queue_ms;
+    // Moving average of the time from the add to the end of the request, in milliseconds
+    float avg_latency_ms;
+} ov_genai_tenant_metrics_t;
+
 /**
 * @struct ov_genai_continuous_batching_pipeline_t
 * @brief This is an interface of ov::genai::ContinuousBatchingPipeline.
@@ -44,13 +118,30 @@ ov_genai_continuous_batching_pipeline_create_with_scheduler(
     const char* model_path,
     ov_genai_scheduler_config_t* scheduler_config);
 
-//OPENVINO_C_API(ov_status_e)
-//ov_genai_continuous_batching_pipeline_create_with_scheduler_device(
-//    ov_genai_continuous_batching_pipeline_t** continuous_batching_pipeline,
-//    const char* model_path,
-//    ov_genai_scheduler_config_t* scheduler_config,
-//    const char* device_name);
-//
+/**
+ * @brief Release the memory allocated by ov_genai_continuous_batching_pipeline_t.
+ * @param continuous_batching_pipeline A pointer to the ov_genai_continuous_batching_pipeline_t to free memory.
+ */
+OPENVINO_C_API(void)
+ov_genai_continuous_batching_pipeline_free(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline);
+
+/**
+ * @brief Constructs a ContinuousBatchingPipeline on a device.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A pointer to the newly created ov_genai_continuous_batching_pipeline_t.
+ * @param model_path Path to the dir model xml/bin files, tokenizers and generation_configs.json.
+ * @param scheduler_config The scheduler config.
+ * @param device_name The device.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_create_with_scheduler_device(
+    ov_genai_continuous_batching_pipeline_t** continuous_batching_pipeline,
+    const char* model_path,
+    ov_genai_scheduler_config_t* scheduler_config,
+    const char* device_name);
+
 //OPENVINO_C_API(ov_status_e)
 //ov_genai_continuous_batching_pipeline_create_with_scheduler_device_plugin(
 //    ov_genai_continuous_batching_pipeline_t** continuous_batching_pipeline,
@@ -60,14 +151,14 @@ ov_genai_continuous_batching_pipeline_create_with_scheduler(
 //    size_t llm_plugin_config_args_size,
 //    size_t tokenizer_plugin_config_args_size,
 //    ...);
-//
+
 //OPENVINO_C_API(ov_status_e)
 //ov_genai_continuous_batching_pipeline_create_with_scheduler_tokenizer(
 //    ov_genai_continuous_batching_pipeline_t** continuous_batching_pipeline,
 //    const char* model_path,
 //    ov_genai_tokenizer_t* tokenizer,
 //    ov_genai_scheduler_config_t* scheduler_config);
-//
+
 //OPENVINO_C_API(ov_status_e)
 //ov_genai_continuous_batching_pipeline_create_with_scheduler_tokenizer_device(
 //    ov_genai_continuous_batching_pipeline_t** continuous_batching_pipeline,
@@ -75,7 +166,7 @@ ov_genai_continuous_batching_pipeline_create_with_scheduler(
 //    ov_genai_tokenizer_t* tokenizer,
 //    ov_genai_scheduler_config_t* scheduler_config,
 //    const char* device_name);
-//
+
 //OPENVINO_C_API(ov_status_e)
 //ov_genai_continuous_batching_pipeline_create_with_scheduler_tokenizer_device_plugin(
 //    ov_genai_continuous_batching_pipeline_t** continuous_batching_pipeline,
@@ -85,24 +176,334 @@ ov_genai_continuous_batching_pipeline_create_with_scheduler(
 //    const char* device_name,
 //    size_t plugin_config_args_size,
 //    ...);
-//
-//
-//OPENVINO_C_API(ov_status_e)
-//ov_genai_continuous_batching_pipeline_get_tokenizer(
-//    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
-//    ov_genai_tokenizer_t** tokenizer);
-//
-//OPENVINO_C_API(ov_status_e)
-//ov_genai_continuous_batching_pipeline_get_config(
-//    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
-//    ov_genai_generation_config_t** generation_config);
-//
-//OPENVINO_C_API(ov_status_e)
-//ov_genai_continuous_batching_pipeline_get_metrics(
-//    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
-//    ov_genai_pipeline_metrics_t* pipeline_metrics);
-//
-//
+
+/**
+ * @brief Constructs a ContinuousBatchingPipeline that decodes speculatively with a draft model.
+ * The draft model shares the scheduler config, num_assistant_tokens or assistant_confidence_threshold
+ * of each request selects how many tokens it proposes per step.
+ * @param continuous_batching_pipeline A pointer to the newly created ov_genai_continuous_batching_pipeline_t.
+ * @param model_path Path to the dir with the main model xml/bin files, tokenizers and generation_configs.json.
+ * @param scheduler_config The scheduler config of the main model.
+ * @param device_name The device of the main model.
+ * @param draft_model_path Path to the dir with the draft model xml/bin files.
+ * @param draft_device_name The device of the draft model.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_create_with_draft_model(
+    ov_genai_continuous_batching_pipeline_t** continuous_batching_pipeline,
+    const char* model_path,
+    ov_genai_scheduler_config_t* scheduler_config,
+    const char* device_name,
+    const char* draft_model_path,
+    const char* draft_device_name);
+
+/**
+ * @brief Constructs a ContinuousBatchingPipeline that decodes speculatively by prompt lookup, without a draft model.
+ * The num_assistant_tokens and max_ngram_size of each request select how many tokens following the match of the
+ * latest n-gram of its output in its prompt are proposed per step.
+ * @param continuous_batching_pipeline A pointer to the newly created ov_genai_continuous_batching_pipeline_t.
+ * @param model_path Path to the dir with the model xml/bin files, tokenizers and generation_configs.json.
+ * @param scheduler_config The scheduler config.
+ * @param device_name The device.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_create_with_prompt_lookup(
+    ov_genai_continuous_batching_pipeline_t** continuous_batching_pipeline,
+    const char* model_path,
+    ov_genai_scheduler_config_t* scheduler_config,
+    const char* device_name);
+
+
+/**
+ * @brief Gets the tokenizer of the pipeline.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A point to ov_genai_continuous_batching_pipeline_t.
+ * @param tokenizer A point to the newly created ov_genai_tokenizer_t.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_get_tokenizer(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    ov_genai_tokenizer_t** tokenizer);
+
+/**
+ * @brief Gets the default generation config of the pipeline.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A point to ov_genai_continuous_batching_pipeline_t.
+ * @param generation_config A point to the newly created ov_genai_generation_config_t.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_get_config(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    ov_genai_generation_config_t** generation_config);
+
+/**
+ * @brief Gets the request counts and the KV cache usage of the pipeline as of its last step.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A point to ov_genai_continuous_batching_pipeline_t.
+ * @param pipeline_metrics The metrics.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_get_metrics(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    ov_genai_pipeline_metrics_t* pipeline_metrics);
+
+
+/**
+ * @brief Sets the admission control of the add_request functions. Over a limit they fail fast with
+ * REQUEST_BUSY, and the try_ variant reports TRY_QUEUE_FULL, instead of queueing the request.
+ * The generate functions are not limited.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A point to ov_genai_continuous_batching_pipeline_t.
+ * @param admission_config The limits, NULL to admit every request.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_set_admission_config(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const ov_genai_admission_config_t* admission_config);
+
+/**
+ * @brief Gets the load seen by the admission control and the suggested retry-after for rejected requests.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A point to ov_genai_continuous_batching_pipeline_t.
+ * @param admission_state The state, all zero but cache_usage without admission control.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_get_admission_state(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    ov_genai_admission_state_t* admission_state);
+
+/**
+ * @brief Turns the coalescing of identical requests on or off. While it is on, a greedy request of one sequence
+ * added with a prompt and config identical to a request in flight joins that request instead of being decoded
+ * again: the model computes it once and each handle reads, or streams, every token of it on its own. A joined
+ * request takes no room and passes no admission control. The request is dropped once all its handles are.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A pointer to the ov_genai_continuous_batching_pipeline_t.
+ * @param enable Non-zero to coalesce the requests added from now on.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_set_request_coalescing(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    int enable);
+
+/**
+ * @brief Gets the number of requests served by joining an identical one since coalescing was turned on.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A pointer to the ov_genai_continuous_batching_pipeline_t.
+ * @param coalesced_requests The number of requests.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_get_coalesced_requests(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    uint64_t* coalesced_requests);
+
+/**
+ * @brief Sets the completion cache of the pipeline. A greedy request of one sequence added with a prompt and a
+ * config seen in a request which finished before is not run again: its handle replays the tokens kept, read or
+ * streamed as those of a running request. The tokens of a request are kept once all of them have been read.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A pointer to the ov_genai_continuous_batching_pipeline_t.
+ * @param cache_config The bounds of the cache, NULL to remove it.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_set_completion_cache(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const ov_genai_completion_cache_config_t* cache_config);
+
+/**
+ * @brief Gets the counters of the completion cache of the pipeline, all 0 without one.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A pointer to the ov_genai_continuous_batching_pipeline_t.
+ * @param cache_stats The counters.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_get_completion_cache_stats(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    ov_genai_completion_cache_stats_t* cache_stats);
+
+/**
+ * @brief Adds a turn of a chat session, created on its first turn, unless the pipeline is full. The request is the
+ * history of the session and the message, templated by the tokenizer: each turn prefills the whole history, which
+ * the prefix cache of the pipeline serves when it still holds its blocks, evicting the blocks of idle sessions
+ * first. The answer joins the history once it has been read whole. The turns of one session go one at a time.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A point to ov_genai_continuous_batching_pipeline_t.
+ * @param request_id The id of the request.
+ * @param session_id The id of the session.
+ * @param prompt The message of the turn.
+ * @param sampling_params The generation config of the request.
+ * @param streamer Passed each new piece of text of the request, NULL for none.
+ * @param max_requests The number of requests the pipeline holds at most, 0 for no limit.
+ * @param generation_handle The handle of the added request, left unset when the pipeline is full.
+ * @param result TRY_OK when the request was added, TRY_QUEUE_FULL when the pipeline is full.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_try_add_session_request(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    uint64_t request_id,
+    const char* session_id,
+    const char* prompt,
+    const ov_genai_generation_config_t* sampling_params,
+    const ov_genai_streamer_t* streamer,
+    size_t max_requests,
+    ov_genai_generation_handle_t** generation_handle,
+    ov_genai_try_status_e* result);
+
+/**
+ * @brief Sets the bounds of the chat sessions of the pipeline. Without a call the sessions are created with no
+ * bound by the first turn of one. The idle_ms of the config is not used: the prefix cache of the pipeline evicts
+ * the blocks of idle sessions by itself.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A pointer to the ov_genai_continuous_batching_pipeline_t.
+ * @param sessions_config The bounds, NULL to forget every session.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_set_chat_sessions(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const ov_genai_chat_sessions_config_t* sessions_config);
+
+/**
+ * @brief Forgets a chat session and its snapshot file.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A pointer to the ov_genai_continuous_batching_pipeline_t.
+ * @param session_id The id of the session.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_end_session(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const char* session_id);
+
+/**
+ * @brief Gets the counters of the chat sessions of the pipeline, all 0 before the first session. A turn with a
+ * history counts as a re-prefill, whether the prefix cache served it or not.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A pointer to the ov_genai_continuous_batching_pipeline_t.
+ * @param sessions_stats The counters.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_get_chat_sessions_stats(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    ov_genai_chat_sessions_stats_t* sessions_stats);
+
+/**
+ * @brief Keeps the tokens of a prompt prefix in a snapshot file, under a model id, for
+ * ov_genai_continuous_batching_pipeline_restore_prefix_snapshots to prefill them after a restart. The prefix
+ * should end where the prompts sharing it go on with other tokens, at the end of a system message for instance.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A pointer to the ov_genai_continuous_batching_pipeline_t, whose tokenizer encodes the prefix.
+ * @param path The snapshot file, created when it does not exist.
+ * @param model_id The model the prefix is kept for, a file may hold the prefixes of several models.
+ * @param prefix The prompt prefix.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_save_prefix_snapshot(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const char* path,
+    const char* model_id,
+    const char* prefix);
+
+/**
+ * @brief Prefills the prefixes a snapshot file keeps for a model, one generated token each, so that the prefix
+ * cache of the pipeline holds their blocks before the first request sharing them. It only helps a pipeline
+ * created with enable_prefix_caching in its scheduler config. The call steps the pipeline until the prefills
+ * are over, make it before adding requests.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A pointer to the ov_genai_continuous_batching_pipeline_t.
+ * @param path The snapshot file, a missing one holds no prefix.
+ * @param model_id The model the prefixes were kept for.
+ * @param restored The number of prefixes prefilled.
+ * @return Status code of the operation: OK(0) for success, GENERAL_ERROR while the pipeline has requests.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_restore_prefix_snapshots(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const char* path,
+    const char* model_id,
+    size_t* restored);
+
+/**
+ * @brief Sets the limits of the request scheduler of the pipeline. Without a call, the requests added with
+ * options are all released at the next step, in their order.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A point to ov_genai_continuous_batching_pipeline_t.
+ * @param scheduler_config The limits.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_set_request_scheduler_config(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const ov_genai_request_scheduler_config_t* scheduler_config);
+
+/**
+ * @brief Sets the weight of a tenant of the request scheduler. While tenants compete for room, each is served
+ * prompt and generated tokens in proportion to its weight, 1 until set.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A pointer to the ov_genai_continuous_batching_pipeline_t.
+ * @param tenant The tenant, NULL for the default tenant.
+ * @param weight The weight, greater than 0.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_set_tenant_weight(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const char* tenant,
+    float weight);
+
+/**
+ * @brief Gets the metrics of a tenant of the request scheduler, all 0 for a tenant without requests.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A pointer to the ov_genai_continuous_batching_pipeline_t.
+ * @param tenant The tenant, NULL for the default tenant.
+ * @param tenant_metrics The metrics.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_get_tenant_metrics(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const char* tenant,
+    ov_genai_tenant_metrics_t* tenant_metrics);
+
+/**
+ * @brief Adds a request held by the request scheduler, which releases it into a later step by priority, then
+ * by the share of its tenant, then by deadline. Until then the handle reports RUNNING with nothing to read. A preempted request is recomputed
+ * from its prompt and the tokens read so far; reading it with ov_genai_generation_handle_read, back or
+ * read_all makes it non-preemptible, use ov_genai_generation_handle_stream or try_read instead.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A point to ov_genai_continuous_batching_pipeline_t.
+ * @param request_id The request id, unique among the running requests.
+ * @param prompt The input text.
+ * @param sampling_params Class to keep generation config parameters.
+ * @param streamer The streamer for ov_genai_generation_handle_stream, NULL to read the outputs instead.
+ * @param options The priority and deadline, NULL for priority 0 without deadline.
+ * @param generation_handle A point to the handle of the new request.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_add_request_with_options(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    uint64_t request_id,
+    const char* prompt,
+    const ov_genai_generation_config_t* sampling_params,
+    const ov_genai_streamer_t* streamer,
+    const ov_genai_request_options_t* options,
+    ov_genai_generation_handle_t** generation_handle);
+
 //OPENVINO_C_API(ov_status_e)
 //ov_genai_continuous_batching_pipeline_get_metrics_add_request_with_input_ids(
 //    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
@@ -110,24 +511,105 @@ ov_genai_continuous_batching_pipeline_create_with_scheduler(
 //    ov_tensor_t* input_ids,
 //    ov_genai_generation_config_t* sampling_params,
 //    ov_genai_generation_handle_t** generation_handle);
-//
-//OPENVINO_C_API(ov_status_e)
-//ov_genai_continuous_batching_pipeline_get_metrics_add_request_with_prompt(
-//    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
-//    uint64_t request_id,
-//    const char* prompt,
-//    ov_genai_generation_config_t* sampling_params,
-//    ov_genai_generation_handle_t** generation_handle);
-//
-//OPENVINO_C_API(ov_status_e)
-//ov_genai_continuous_batching_pipeline_step(
-//    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline);
-//
-//OPENVINO_C_API(ov_status_e)
-//ov_genai_continuous_batching_pipeline_has_non_finished_requests(
-//    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
-//    int* flag);
-//
+
+/**
+ * @brief Adds a request, read with ov_genai_generation_handle_read once the steps produce its tokens.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A point to ov_genai_continuous_batching_pipeline_t.
+ * @param request_id The request id, unique among the running requests.
+ * @param prompt The input text.
+ * @param sampling_params Class to keep generation config parameters.
+ * @param generation_handle A point to the handle of the new request.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_get_metrics_add_request_with_prompt(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    uint64_t request_id,
+    const char* prompt,
+    ov_genai_generation_config_t* sampling_params,
+    ov_genai_generation_handle_t** generation_handle);
+
+/**
+ * @brief Adds a request whose text is passed to the streamer by ov_genai_generation_handle_stream.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A point to ov_genai_continuous_batching_pipeline_t.
+ * @param request_id The request id, unique among the running requests.
+ * @param prompt The input text.
+ * @param sampling_params Class to keep generation config parameters.
+ * @param streamer The streamer, copied into the generation handle.
+ * @param generation_handle A point to the handle of the new request.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_add_request_with_prompt_and_streamer(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    uint64_t request_id,
+    const char* prompt,
+    const ov_genai_generation_config_t* sampling_params,
+    const ov_genai_streamer_t* streamer,
+    ov_genai_generation_handle_t** generation_handle);
+
+/**
+ * @brief Adds a request unless the pipeline already holds max_requests requests. A full pipeline is
+ * reported as TRY_QUEUE_FULL, without an exception or an error message.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A point to ov_genai_continuous_batching_pipeline_t.
+ * @param request_id The request id, unique among the running requests.
+ * @param prompt The input text.
+ * @param sampling_params Class to keep generation config parameters.
+ * @param streamer The streamer for ov_genai_generation_handle_stream, NULL to read the outputs instead.
+ * @param max_requests The number of requests the pipeline may hold, counted as of the last step plus
+ * the requests added since, 0 for no limit.
+ * @param generation_handle A point to the handle of the new request, set for TRY_OK only.
+ * @param result TRY_OK or TRY_QUEUE_FULL.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_try_add_request(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    uint64_t request_id,
+    const char* prompt,
+    const ov_genai_generation_config_t* sampling_params,
+    const ov_genai_streamer_t* streamer,
+    size_t max_requests,
+    ov_genai_generation_handle_t** generation_handle,
+    ov_genai_try_status_e* result);
+
+/**
+ * @brief Runs one step of the pipeline, which schedules the requests and produces one token of each.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A point to ov_genai_continuous_batching_pipeline_t.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_step(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline);
+
+/**
+ * @brief Runs one step when a request is left to run.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A point to ov_genai_continuous_batching_pipeline_t.
+ * @param result TRY_OK after a step, TRY_IDLE when no request was left and nothing was run.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_try_step(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    ov_genai_try_status_e* result);
+
+/**
+ * @brief Gets whether a request is left to run.
+ * @ingroup ov_genai_continuous_batching_pipeline_c_api
+ * @param continuous_batching_pipeline A point to ov_genai_continuous_batching_pipeline_t.
+ * @param flag 1 when a request is left, 0 otherwise.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_has_non_finished_requests(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    int* flag);
+
 //OPENVINO_C_API(ov_status_e)
 //ov_genai_continuous_batching_pipeline_generate_with_input_ids(
 //    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline, 
@@ -137,7 +619,7 @@ ov_genai_continuous_batching_pipeline_create_with_scheduler(
 //    size_t sampling_params_size,
 //    ov_genai_encoded_generation_result_t** encoded_generation_results,
 //    size_t* encoded_generation_results_size);
-//
+
 //OPENVINO_C_API(ov_status_e)
 //ov_genai_continuous_batching_pipeline_generate_with_input_ids_and_streamer(
 //    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
@@ -148,7 +630,7 @@ ov_genai_continuous_batching_pipeline_create_with_scheduler(
 //    ov_genai_streamer_callback_t* callback, 
 //    ov_genai_encoded_generation_result_t** encoded_generation_results,
 //    size_t* encoded_generation_results_size);
-//
+
 //OPENVINO_C_API(ov_status_e)
 //ov_genai_continuous_batching_pipeline_generate_with_prompts(
 //    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
@@ -157,7 +639,7 @@ ov_genai_continuous_batching_pipeline_create_with_scheduler(
 //    size_t sampling_params_size,
 //    ov_genai_generation_result_t** generation_results,
 //    size_t* generation_results_size);
-//
+
 //OPENVINO_C_API(ov_status_e)
 //ov_genai_continuous_batching_pipeline_generate_with_prompts_and_streamer(
 //    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
@@ -167,13 +649,13 @@ ov_genai_continuous_batching_pipeline_create_with_scheduler(
 //    ov_genai_streamer_callback_t* callback,
 //    ov_genai_generation_result_t** generation_results,
 //    size_t* generation_results_size);
-//
-//
+
+
 //OPENVINO_C_API(ov_status_e)
 //ov_genai_continuous_batching_pipeline_start_chat(
 //    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
 //    const char* system_message);
-//
+
 //OPENVINO_C_API(ov_status_e)
 //ov_genai_continuous_batching_pipeline_finish_chat(
 //    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline);
\ No newline at end of file
@@ -18,6 +18,7 @@
 #include "openvino/genai/visibility.hpp"
 
 #include "ov_genai_common.h"
+#include "ov_genai_perf_metrics.h"
 
 /**
  * @struct ov_genai_decoded_results_t
@@ -34,4 +35,16 @@ ov_genai_decoded_results_free(ov_genai_decoded_results_t* decoded_results);
 
 OPENVINO_C_API(ov_status_e)
 ov_genai_decoded_results_get_texts(ov_genai_decoded_results_t* decoded_results, 
-	char** texts);
\ No newline at end of file
+	char** texts);
+
+/**
+ * @brief Gets the performance metrics collected during the generation.
+ * The returned instance shares storage with decoded_results, no series is copied.
+ * @ingroup ov_genai_decoded_results_c_api
+ * @param decoded_results A pointer to the ov_genai_decoded_results_t instance.
+ * @param perf_metrics A pointer to the newly created ov_genai_perf_metrics_t, free it with ov_genai_perf_metrics_free.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_decoded_results_get_perf_metrics(ov_genai_decoded_results_t* decoded_results,
+	ov_genai_perf_metrics_t** perf_metrics);
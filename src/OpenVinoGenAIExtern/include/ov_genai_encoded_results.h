@@ -18,6 +18,7 @@
 #include "openvino/genai/visibility.hpp"
 
 #include "ov_genai_common.h"
+#include "ov_genai_perf_metrics.h"
 
 /**
  * @struct ov_genai_encoded_results_t
@@ -30,4 +31,16 @@ OPENVINO_C_API(ov_status_e)
 ov_genai_encoded_results_create(ov_genai_encoded_results_t** encoded_results);
 
 OPENVINO_C_API(void)
-ov_genai_encoded_results_free(ov_genai_encoded_results_t* encoded_results);
\ No newline at end of file
+ov_genai_encoded_results_free(ov_genai_encoded_results_t* encoded_results);
+
+/**
+ * @brief Gets the performance metrics collected during the generation.
+ * The returned instance shares storage with encoded_results, no series is copied.
+ * @ingroup ov_genai_encoded_results_c_api
+ * @param encoded_results A pointer to the ov_genai_encoded_results_t instance.
+ * @param perf_metrics A pointer to the newly created ov_genai_perf_metrics_t, free it with ov_genai_perf_metrics_free.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_encoded_results_get_perf_metrics(ov_genai_encoded_results_t* encoded_results,
+	ov_genai_perf_metrics_t** perf_metrics);
@@ -40,6 +40,17 @@ struct generation_config_param
     size_t max_new_tokens = SIZE_MAX;
     size_t max_length = SIZE_MAX;
     bool ignore_eos = false;
+    // 0 keeps the value of the config
+    size_t min_new_tokens = 0;
+    // NULL keeps the stop strings of the config, a NULL string is rejected with INVALID_C_PARAM
+    const char* const* stop_strings = nullptr;
+    size_t stop_strings_size = 0;
+    bool include_stop_str_in_output = false;
+    // NULL keeps the stop tokens of the config
+    const int64_t* stop_token_ids = nullptr;
+    size_t stop_token_ids_size = 0;
+    // 0 keeps the value of the config
+    size_t logprobs = 0;
 
     // Beam search specific
     size_t num_beam_groups = 1;
@@ -56,6 +67,16 @@ struct generation_config_param
     size_t top_k = 50;
     bool do_sample = false;
     float repetition_penalty = 1.0f;
+    // 0 keeps the values of the config
+    float presence_penalty = 0.0f;
+    float frequency_penalty = 0.0f;
+    size_t rng_seed = 0;
+
+    // Speculative decoding
+    size_t num_assistant_tokens = 0;
+    float assistant_confidence_threshold = 0.0f;
+    // Prompt lookup, the longest n-gram of the prompt matched against the end of the output
+    size_t max_ngram_size = 0;
 
     // EOS special token
     int64_t eos_token_id = -1;
@@ -71,6 +92,12 @@ typedef struct generation_config_param generation_config_param_t;
 
 ov::AnyMap generation_config_param_to_anymap(const generation_config_param_t param);
 
+/**
+ * @brief Checks the arrays of a generation_config_param_t, a NULL entry among the stop strings is rejected as by
+ * ov_genai_generation_config_set_stop_strings. The entry points taking a parameter return INVALID_C_PARAM for it.
+ */
+bool generation_config_param_is_valid(const generation_config_param_t& param);
+
 
 /**
  * @brief Constructs OpenVINO GenAI GenerationConfig instance by default.
@@ -193,6 +220,127 @@ OPENVINO_C_API(ov_status_e)
 ov_genai_generation_config_set_ignore_eos(const ov_genai_generation_config_t* generation_config,
     bool ignore_eos);
 
+/**
+ * @brief Get the minimum number of tokens to generate, the stop conditions are ignored before it.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param min_new_tokens A pointer to the value of min_new_tokens.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_get_min_new_tokens(const ov_genai_generation_config_t* generation_config,
+    size_t* min_new_tokens);
+
+/**
+ * @brief Set the minimum number of tokens to generate, the stop conditions are ignored before it.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param min_new_tokens The value of min_new_tokens.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_set_min_new_tokens(const ov_genai_generation_config_t* generation_config,
+    size_t min_new_tokens);
+
+/**
+ * @brief Get the strings that stop the generation once the output ends with one of them.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param stop_strings The NUL terminated strings one after the other, released with ov_genai_free.
+ * @param size The size of the block, terminators included.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_get_stop_strings(const ov_genai_generation_config_t* generation_config,
+    char** stop_strings,
+    size_t* size);
+
+/**
+ * @brief Set the strings that stop the generation once the output ends with one of them. They are matched
+ * on the decoded text at every step, so the generation ends on the step that completes one.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param stop_strings The strings, replacing the current ones.
+ * @param size The number of strings, 0 to clear them.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_set_stop_strings(const ov_genai_generation_config_t* generation_config,
+    const char* const* stop_strings,
+    size_t size);
+
+/**
+ * @brief Get whether the stop string which ended the generation is kept at the end of the output.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param include_stop_str_in_output A pointer to the value of include_stop_str_in_output.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_get_include_stop_str_in_output(const ov_genai_generation_config_t* generation_config,
+    bool* include_stop_str_in_output);
+
+/**
+ * @brief Set whether the stop string which ended the generation is kept at the end of the output.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param include_stop_str_in_output The value of include_stop_str_in_output.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_set_include_stop_str_in_output(const ov_genai_generation_config_t* generation_config,
+    bool include_stop_str_in_output);
+
+/**
+ * @brief Get the tokens that stop the generation, in addition to eos_token_id.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param stop_token_ids The buffer receiving the tokens, NULL to get their number only.
+ * @param capacity The number of tokens the buffer holds.
+ * @param size A pointer to the number of tokens, which may exceed capacity.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_get_stop_token_ids(const ov_genai_generation_config_t* generation_config,
+    int64_t* stop_token_ids,
+    size_t capacity,
+    size_t* size);
+
+/**
+ * @brief Set the tokens that stop the generation, in addition to eos_token_id.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param stop_token_ids The tokens, replacing the current ones.
+ * @param size The number of tokens, 0 to clear them.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_set_stop_token_ids(const ov_genai_generation_config_t* generation_config,
+    const int64_t* stop_token_ids,
+    size_t size);
+
+/**
+ * @brief Get the number of top log probabilities returned for each generated token, 0 for none.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param logprobs A pointer to the value of logprobs.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_get_logprobs(const ov_genai_generation_config_t* generation_config,
+    size_t* logprobs);
+
+/**
+ * @brief Set the number of top log probabilities returned for each generated token, 0 for none.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param logprobs The value of logprobs.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_set_logprobs(const ov_genai_generation_config_t* generation_config,
+    size_t logprobs);
+
 // Beam search specific
 /**
  * @brief Get the number of groups to divide `num_beams` into in order to ensure diversity among different groups of beams.
@@ -477,6 +625,140 @@ OPENVINO_C_API(ov_status_e)
 ov_genai_generation_config_set_repetition_penalty(const ov_genai_generation_config_t* generation_config,
     float repetition_penalty);
 
+/**
+ * @brief Get the penalty subtracted from the logit of every token already generated. 0.0 means no penalty.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param presence_penalty A pointer to the value of presence_penalty.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_get_presence_penalty(const ov_genai_generation_config_t* generation_config,
+    float* presence_penalty);
+
+/**
+ * @brief Set the penalty subtracted from the logit of every token already generated. 0.0 means no penalty.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param presence_penalty The value of presence_penalty.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_set_presence_penalty(const ov_genai_generation_config_t* generation_config,
+    float presence_penalty);
+
+/**
+ * @brief Get the penalty subtracted from the logit of a token for every time it was generated. 0.0 means no penalty.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param frequency_penalty A pointer to the value of frequency_penalty.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_get_frequency_penalty(const ov_genai_generation_config_t* generation_config,
+    float* frequency_penalty);
+
+/**
+ * @brief Set the penalty subtracted from the logit of a token for every time it was generated. 0.0 means no penalty.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param frequency_penalty The value of frequency_penalty.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_set_frequency_penalty(const ov_genai_generation_config_t* generation_config,
+    float frequency_penalty);
+
+/**
+ * @brief Get the seed of the random generator of multinomial sampling.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param rng_seed A pointer to the value of rng_seed.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_get_rng_seed(const ov_genai_generation_config_t* generation_config,
+    size_t* rng_seed);
+
+/**
+ * @brief Set the seed of the random generator of multinomial sampling, to make sampled outputs reproducible.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param rng_seed The value of rng_seed.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_set_rng_seed(const ov_genai_generation_config_t* generation_config,
+    size_t rng_seed);
+
+// Speculative decoding
+/**
+ * @brief Get the number of tokens the draft model proposes per step. 0 means the threshold is used instead.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param num_assistant_tokens A pointer to the value of num_assistant_tokens.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_get_num_assistant_tokens(const ov_genai_generation_config_t* generation_config,
+    size_t* num_assistant_tokens);
+
+/**
+ * @brief Set the number of tokens the draft model proposes per step. Only used with a draft model.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param num_assistant_tokens The value of num_assistant_tokens.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_set_num_assistant_tokens(const ov_genai_generation_config_t* generation_config,
+    size_t num_assistant_tokens);
+
+/**
+ * @brief Get the probability below which the draft model stops proposing tokens.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param assistant_confidence_threshold A pointer to the value of assistant_confidence_threshold.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_get_assistant_confidence_threshold(const ov_genai_generation_config_t* generation_config,
+    float* assistant_confidence_threshold);
+
+/**
+ * @brief Set the probability below which the draft model stops proposing tokens. Only used when num_assistant_tokens is 0.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param assistant_confidence_threshold The value of assistant_confidence_threshold.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_set_assistant_confidence_threshold(const ov_genai_generation_config_t* generation_config,
+    float assistant_confidence_threshold);
+
+/**
+ * @brief Get the longest n-gram of the prompt a pipeline with prompt lookup matches against the end of the output.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param max_ngram_size A pointer to the value of max_ngram_size.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_get_max_ngram_size(const ov_genai_generation_config_t* generation_config,
+    size_t* max_ngram_size);
+
+/**
+ * @brief Set the longest n-gram of the prompt a pipeline with prompt lookup matches against the end of the output.
+ * The tokens following the match, up to num_assistant_tokens, are proposed. Only used with prompt lookup.
+ * @ingroup ov_genai_generation_config_c_api
+ * @param generation_config A pointer to the ov_genai_generation_config_t.
+ * @param max_ngram_size The value of max_ngram_size.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_config_set_max_ngram_size(const ov_genai_generation_config_t* generation_config,
+    size_t max_ngram_size);
+
 
 // EOS special token
 /**
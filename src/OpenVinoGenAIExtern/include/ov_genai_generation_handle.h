@@ -54,8 +54,36 @@ ov_genai_generation_handle_read(
 	ov_genai_generation_handle_t* generation_handle,
 	ov_genai_generation_outputs_t** generation_outputs);
 
+/**
+ * @brief Reads the outputs generated since the last read without waiting. When there is nothing to
+ * read the state of the request is reported instead, without an exception or an error message.
+ * @param generation_handle A point to ov_genai_generation_handle_t.
+ * @param generation_outputs A point to the outputs, set for TRY_OK only.
+ * @param result TRY_OK, TRY_NO_DATA while the request runs, TRY_FINISHED or TRY_DROPPED once it is over
+ * and all of its outputs have been read.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_handle_try_read(
+	ov_genai_generation_handle_t* generation_handle,
+	ov_genai_generation_outputs_t** generation_outputs,
+	ov_genai_try_status_e* result);
+
 OPENVINO_C_API(ov_status_e)
 ov_genai_generation_handle_read_all(
 	ov_genai_generation_handle_t* generation_handle,
 	ov_genai_generation_output_t** generation_output,
-	size_t* size);
\ No newline at end of file
+	size_t* size);
+
+/**
+ * @brief Passes the text of the tokens generated since the last call to the streamer of the handle.
+ * Call it after each ov_genai_continuous_batching_pipeline_step, from one thread at a time. When the
+ * streamer asks to stop, the request is dropped.
+ * @param generation_handle A handle created by ov_genai_continuous_batching_pipeline_add_request_with_prompt_and_streamer.
+ * @param finished Set to 1 once the request has finished and all of its text has been passed.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_handle_stream(
+	ov_genai_generation_handle_t* generation_handle,
+	int* finished);
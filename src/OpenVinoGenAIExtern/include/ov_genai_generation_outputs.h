@@ -41,6 +41,21 @@ ov_genai_generation_output_get_generated_ids(
 	int64_t* generated_ids,
 	size_t* size);
 
+/**
+ * @brief Get the generated tokens into a buffer of a known size, which get_generated_ids assumes large enough.
+ * @param generation_output A pointer to the ov_genai_generation_output_t.
+ * @param generated_ids The buffer receiving the tokens, NULL to get their number only.
+ * @param capacity The number of tokens the buffer holds.
+ * @param size A pointer to the number of tokens, which may exceed capacity.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_output_copy_generated_ids(
+	ov_genai_generation_output_t* generation_output,
+	int64_t* generated_ids,
+	size_t capacity,
+	size_t* size);
+
 OPENVINO_C_API(ov_status_e)
 ov_genai_generation_output_get_score(
 	ov_genai_generation_output_t* generation_output,
@@ -66,4 +81,28 @@ OPENVINO_C_API(ov_status_e)
 ov_genai_generation_outputs_at(
 	ov_genai_generation_outputs_t* generation_outputs,
 	uint64_t key,
-	ov_genai_generation_output_t** generation_output);
\ No newline at end of file
+	ov_genai_generation_output_t** generation_output);
+
+/**
+ * @brief Get the number of sequences held by the generation outputs.
+ * @param generation_outputs A pointer to the ov_genai_generation_outputs_t.
+ * @param size The number of sequences.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_outputs_get_size(
+	ov_genai_generation_outputs_t* generation_outputs,
+	size_t* size);
+
+/**
+ * @brief Get the sequence ids used as keys of the generation outputs.
+ * @param generation_outputs A pointer to the ov_genai_generation_outputs_t.
+ * @param keys A caller allocated buffer of ov_genai_generation_outputs_get_size elements.
+ * @param size The number of keys written.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_generation_outputs_get_keys(
+	ov_genai_generation_outputs_t* generation_outputs,
+	uint64_t* keys,
+	size_t* size);
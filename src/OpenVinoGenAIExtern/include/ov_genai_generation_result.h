@@ -22,7 +22,7 @@
 */
 typedef struct ov_genai_generation_result ov_genai_generation_result_t;
 
-void
+OPENVINO_C_API(void)
 ov_genai_generation_result_free(
 	ov_genai_generation_result_t* generation_result);
 
@@ -12,6 +12,7 @@
 
 #pragma once
 #include "genai_common.h"
+#include "ov_genai_cancellation_token.h"
 #include "ov_genai_common.h"
 #include "ov_genai_decoded_results.h"
 #include "ov_genai_encoded_results.h"
@@ -41,8 +42,8 @@ OPENVINO_C_API(int) ov_genai_llm_sizeof();
  * @ingroup ov_genai_llm_pipeline_c_api
  * @param model_path Path to the dir model xml/bin files, tokenizers and generation_configs.json
  * @param device_name optional device
- * @param plugin_config optional plugin_config
  * @param llm_pipeline A point to ov_genai_llm_pipeline_t
+ * @param ... optional plugin_config, property key and value strings in pairs terminated by NULL
  * @return Status code of the operation: OK(0) for success.
  */
 OPENVINO_C_API(ov_status_e)
@@ -90,6 +91,7 @@ ov_genai_llm_pipeline_create_with_request_config(
  * @param tokenizer manually initialized ov::Tokenizer 
  * @param device_name optional device
  * @param llm_pipeline A point to ov_genai_llm_pipeline_t.
+ * @param ... optional plugin_config, property key and value strings in pairs terminated by NULL
  * @return Status code of the operation: OK(0) for success.
  */
 OPENVINO_C_API(ov_status_e)
@@ -100,6 +102,46 @@ ov_genai_llm_pipeline_create_with_model_path_tokenizer(
 	ov_genai_llm_pipeline_t** llm_pipeline, ...);
 
 
+/**
+ * @brief Constructs an LLMPipeline that decodes speculatively with a smaller draft model.
+ * The draft model proposes num_assistant_tokens (or tokens above assistant_confidence_threshold)
+ * per step and the main model validates them in a single inference.
+ * @ingroup ov_genai_llm_pipeline_c_api
+ * @param model_path Path to the dir with the main model xml/bin files, tokenizers and generation_configs.json
+ * @param device_name device of the main model
+ * @param draft_model_path Path to the dir with the draft model xml/bin files
+ * @param draft_device_name device of the draft model
+ * @param llm_pipeline A point to ov_genai_llm_pipeline_t
+ * @param ... optional plugin_config, property key and value strings in pairs terminated by NULL
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_llm_pipeline_create_with_draft_model(
+	const char* model_path,
+	const char* device_name,
+	const char* draft_model_path,
+	const char* draft_device_name,
+	ov_genai_llm_pipeline_t** llm_pipeline, ...);
+
+/**
+ * @brief Constructs an LLMPipeline that decodes speculatively without a draft model: the tokens which followed
+ * the latest n-gram of the output in the prompt are proposed, up to num_assistant_tokens, and the model validates
+ * them in a single inference. Suits outputs copying their input, such as edits and summaries. The generation
+ * configs should set num_assistant_tokens and max_ngram_size.
+ * @ingroup ov_genai_llm_pipeline_c_api
+ * @param model_path Path to the dir model xml/bin files, tokenizers and generation_configs.json
+ * @param device_name optional device
+ * @param llm_pipeline A point to ov_genai_llm_pipeline_t
+ * @param ... optional plugin_config, property key and value strings in pairs terminated by NULL
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_llm_pipeline_create_with_prompt_lookup(
+	const char* model_path,
+	const char* device_name,
+	ov_genai_llm_pipeline_t** llm_pipeline, ...);
+
+
 /**
  * @brief Release the memory allocated by ov_genai_llm_pipeline_t.
  * @ingroup ov_genai_llm_pipeline_c_api
@@ -111,6 +153,61 @@ ov_genai_llm_pipeline_free(
 
 
 
+/**
+ * @brief Attaches a cancellation token to every following generate call of the pipeline. A cancelled
+ * token fails a call before it starts with INFER_CANCELLED. A running call with one input and one
+ * returned sequence, greedy or multinomial, stops before its next token and returns the text generated
+ * so far; other calls cannot be stopped between steps and run to their end.
+ * @ingroup ov_genai_llm_pipeline_c_api
+ * @param llm_pipeline A point to ov_genai_llm_pipeline_t.
+ * @param cancellation_token The token, NULL to detach the current one.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_llm_pipeline_set_cancellation_token(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	const ov_genai_cancellation_token_t* cancellation_token);
+
+/**
+ * @brief Sets the completion cache of the pipeline. A greedy generation for one prompt, outside of a chat,
+ * whose prompt and config were seen in a generation which ran to its end is not run again: the text kept is
+ * returned, and passed to the streamer in one call.
+ * @ingroup ov_genai_llm_pipeline_c_api
+ * @param llm_pipeline A point to ov_genai_llm_pipeline_t.
+ * @param cache_config The bounds of the cache, NULL to remove it.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_llm_pipeline_set_completion_cache(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	const ov_genai_completion_cache_config_t* cache_config);
+
+/**
+ * @brief Gets the counters of the completion cache of the pipeline, all 0 without one.
+ * @ingroup ov_genai_llm_pipeline_c_api
+ * @param llm_pipeline A point to ov_genai_llm_pipeline_t.
+ * @param cache_stats The counters.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_llm_pipeline_get_completion_cache_stats(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	ov_genai_completion_cache_stats_t* cache_stats);
+
+/**
+ * @brief Gets the acceptance counters of the draft model or of the prompt lookup, all 0 for a pipeline created
+ * with neither.
+ * @ingroup ov_genai_llm_pipeline_c_api
+ * @param llm_pipeline A point to ov_genai_llm_pipeline_t.
+ * @param speculative_metrics The counters.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_llm_pipeline_get_speculative_metrics(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	ov_genai_speculative_metrics_t* speculative_metrics);
+
+
 /**
  * @brief High level generate that receives prompts as a string  and returns decoded output.
  * @param llm_pipeline A point to ov_genai_llm_pipeline_t.
@@ -247,6 +344,26 @@ ov_genai_llm_pipeline_generate_strings_with_config_function(
 );
 
 
+/**
+ * @brief High level generate that receives prompts as a string, passes each new piece of text to the
+ * streamer as it is decoded and returns decoded output.
+ * @param llm_pipeline A point to ov_genai_llm_pipeline_t.
+ * @param inputs The input text.
+ * @param generation_config Class to keep generation config parameters, NULL for the pipeline default.
+ * @param streamer The streamer, called on the thread running the generation.
+ * @param decoded_results A point to decodedResults decoded resulting text.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_llm_pipeline_generate_string_with_streamer(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	const char* inputs,
+	const ov_genai_generation_config_t* generation_config,
+	const ov_genai_streamer_t* streamer,
+	ov_genai_decoded_results_t** decoded_results
+);
+
+
 /**
  * @brief High level generate that receives prompts as a string and returns decoded output.
  * @param llm_pipeline A point to ov_genai_llm_pipeline_t.
@@ -468,4 +585,108 @@ ov_genai_llm_pipeline_generate_start_chat(
 
 OPENVINO_C_API(ov_status_e)
 ov_genai_llm_pipeline_generate_finish_chat(
-	ov_genai_llm_pipeline_t* llm_pipeline);
\ No newline at end of file
+	ov_genai_llm_pipeline_t* llm_pipeline);
+
+/**
+ * @brief Exports the chat of the pipeline, from start_chat or an import, into a blob holding its messages.
+ * Only the turns generated from a single prompt are in it, and not the KV cache of the pipeline.
+ * @ingroup ov_genai_llm_pipeline_c_api
+ * @param llm_pipeline A pointer to the ov_genai_llm_pipeline_t.
+ * @param blob The blob, released with ov_genai_free.
+ * @param blob_size The size of the blob in bytes.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_llm_pipeline_export_chat(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	char** blob,
+	size_t* blob_size);
+
+/**
+ * @brief Makes a chat exported by ov_genai_llm_pipeline_export_chat, from a pipeline of the same model, the chat
+ * of the pipeline in place of its current one. The pipeline has no KV cache of the imported history: each of its
+ * turns prefills the whole history again, templated by the tokenizer, until finish_chat.
+ * @ingroup ov_genai_llm_pipeline_c_api
+ * @param llm_pipeline A pointer to the ov_genai_llm_pipeline_t.
+ * @param blob The blob.
+ * @param blob_size The size of the blob in bytes.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_llm_pipeline_import_chat(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	const char* blob,
+	size_t blob_size);
+
+/**
+ * @brief Sets the bounds of the chat sessions of the pipeline. Without a call the sessions are created with no
+ * bound by the first turn of one. The sessions take over the chat of the pipeline, do not mix their turns with
+ * start_chat and finish_chat.
+ * @ingroup ov_genai_llm_pipeline_c_api
+ * @param llm_pipeline A pointer to the ov_genai_llm_pipeline_t.
+ * @param sessions_config The bounds, NULL to forget every session.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_llm_pipeline_set_chat_sessions(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	const ov_genai_chat_sessions_config_t* sessions_config);
+
+/**
+ * @brief Answers a turn of a chat session, created on its first turn. The pipeline holds the KV cache of one
+ * session, the one of its latest turn, which the next turn of another session drops. A session without a KV
+ * cache prefills its whole history again, from memory or from its snapshot file.
+ * @ingroup ov_genai_llm_pipeline_c_api
+ * @param llm_pipeline A pointer to the ov_genai_llm_pipeline_t.
+ * @param session_id The id of the session.
+ * @param inputs The message of the turn.
+ * @param generation_config Class to keep generation config parameters, NULL for the pipeline default.
+ * @param streamer The streamer, NULL for none.
+ * @param decoded_results A point to decodedResults decoded resulting text.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_llm_pipeline_generate_in_session(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	const char* session_id,
+	const char* inputs,
+	const ov_genai_generation_config_t* generation_config,
+	const ov_genai_streamer_t* streamer,
+	ov_genai_decoded_results_t** decoded_results);
+
+/**
+ * @brief Drops the KV cache of the session holding it when the session has been idle for longer than the
+ * idle_ms of the config. The messages stay, the next turn of the session prefills them again.
+ * @ingroup ov_genai_llm_pipeline_c_api
+ * @param llm_pipeline A pointer to the ov_genai_llm_pipeline_t.
+ * @param evicted The number of sessions whose KV cache was dropped.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_llm_pipeline_evict_idle_sessions(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	size_t* evicted);
+
+/**
+ * @brief Forgets a chat session, its KV cache and its snapshot file.
+ * @ingroup ov_genai_llm_pipeline_c_api
+ * @param llm_pipeline A pointer to the ov_genai_llm_pipeline_t.
+ * @param session_id The id of the session.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_llm_pipeline_end_session(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	const char* session_id);
+
+/**
+ * @brief Gets the counters of the chat sessions of the pipeline, all 0 before the first session.
+ * @ingroup ov_genai_llm_pipeline_c_api
+ * @param llm_pipeline A pointer to the ov_genai_llm_pipeline_t.
+ * @param sessions_stats The counters.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_llm_pipeline_get_chat_sessions_stats(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	ov_genai_chat_sessions_stats_t* sessions_stats);
\ No newline at end of file
@@ -20,6 +20,7 @@
 #include "openvino/genai/visibility.hpp"
 
 #include "ov_genai_common.h"
+#include "ov_genai_raw_perf_metrics.h"
 
 /**
  * @struct ov_genai_mean_std_pair_t
@@ -131,3 +132,16 @@ ov_genai_operator_add(
 	ov_genai_perf_metrics_t* perf_metrics,
 	ov_genai_perf_metrics_t* other_perf_metrics,
 	ov_genai_perf_metrics_t** new_perf_metrics);
+
+/**
+ * @brief Gets the raw metrics of the PerfMetrics instance.
+ * The returned instance shares storage with perf_metrics, so its views borrow the original series.
+ * @ingroup ov_genai_perf_metrics_c_api
+ * @param perf_metrics A pointer to the ov_genai_perf_metrics_t instance.
+ * @param raw_perf_metrics A pointer to the newly created ov_genai_raw_perf_metrics_t, free it with ov_genai_raw_perf_metrics_free.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_perf_metrics_get_raw_metrics(
+	ov_genai_perf_metrics_t* perf_metrics,
+	ov_genai_raw_perf_metrics_t** raw_perf_metrics);
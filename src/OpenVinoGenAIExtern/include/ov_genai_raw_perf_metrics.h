@@ -32,6 +32,43 @@ using MicroSeconds = std::chrono::duration<float, std::ratio<1, 1000000>>;
  */
 typedef struct ov_genai_raw_perf_metrics ov_genai_raw_perf_metrics_t;
 
+/**
+ * @enum ov_genai_raw_perf_metrics_durations_e
+ * @ingroup ov_genai_raw_perf_metrics_c_api
+ * @brief This enum selects one of the microsecond duration series kept by RawPerfMetrics.
+ */
+typedef enum {
+	RAW_GENERATE_DURATIONS = 0,        //!< generate_durations
+	RAW_TOKENIZATION_DURATIONS = 1,    //!< tokenization_durations
+	RAW_DETOKENIZATION_DURATIONS = 2,  //!< detokenization_durations
+	RAW_TIMES_TO_FIRST_TOKEN = 3,      //!< m_times_to_first_token
+	RAW_DURATIONS = 4,                 //!< m_durations
+} ov_genai_raw_perf_metrics_durations_e;
+
+/**
+ * @struct ov_genai_raw_perf_metrics_views_t
+ * @ingroup ov_genai_raw_perf_metrics_c_api
+ * @brief Borrowed views of every series kept by RawPerfMetrics.
+ * The pointers refer to the storage of the RawPerfMetrics instance itself, nothing is copied and nothing
+ * has to be freed. They stay valid until the instance is modified or released.
+ */
+typedef struct {
+	const float* generate_durations;          //!< Generate durations in microseconds.
+	size_t generate_durations_size;
+	const float* tokenization_durations;      //!< Tokenization durations in microseconds.
+	size_t tokenization_durations_size;
+	const float* detokenization_durations;    //!< Detokenization durations in microseconds.
+	size_t detokenization_durations_size;
+	const float* m_times_to_first_token;      //!< Times to first token in microseconds.
+	size_t m_times_to_first_token_size;
+	const int64_t* m_new_token_times;         //!< New token times in steady clock nanoseconds.
+	size_t m_new_token_times_size;
+	const size_t* m_batch_sizes;              //!< Batch sizes.
+	size_t m_batch_sizes_size;
+	const float* m_durations;                 //!< Durations in microseconds.
+	size_t m_durations_size;
+} ov_genai_raw_perf_metrics_views_t;
+
 /**
  * @brief Constructs OpenVINO RawPerfMetrics instance by default.
  * @ingroup ov_genai_raw_perf_metrics_c_api
@@ -245,4 +282,32 @@ OPENVINO_C_API(ov_status_e)
 ov_genai_raw_perf_metrics_set_m_durations(
 	ov_genai_raw_perf_metrics_t* raw_perf_metrics,
 	float* m_durations,
-	size_t length);
\ No newline at end of file
+	size_t length);
+
+/**
+ * @brief Borrows one duration series of the RawPerfMetrics instance without copying it.
+ * @ingroup ov_genai_raw_perf_metrics_c_api
+ * @param raw_perf_metrics A pointer to the ov_genai_raw_perf_metrics_t instance.
+ * @param series The series to borrow.
+ * @param micro_seconds A pointer to the borrowed microsecond durations, valid until raw_perf_metrics is modified or freed.
+ * @param length A pointer to the length of the borrowed array.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_raw_perf_metrics_get_durations_view(
+	const ov_genai_raw_perf_metrics_t* raw_perf_metrics,
+	ov_genai_raw_perf_metrics_durations_e series,
+	const float** micro_seconds,
+	size_t* length);
+
+/**
+ * @brief Borrows all series of the RawPerfMetrics instance in a single call without copying them.
+ * @ingroup ov_genai_raw_perf_metrics_c_api
+ * @param raw_perf_metrics A pointer to the ov_genai_raw_perf_metrics_t instance.
+ * @param views A pointer to the structure receiving the borrowed views.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_raw_perf_metrics_get_views(
+	const ov_genai_raw_perf_metrics_t* raw_perf_metrics,
+	ov_genai_raw_perf_metrics_views_t* views);
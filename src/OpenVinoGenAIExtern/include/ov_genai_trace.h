@@ -0,0 +1,82 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file ov_genai_trace.h
+* @brief This is a header file for the ov_genai_trace C API, an opt-in per-request span tracer for the pipelines.
+* Spans are recorded into a fixed size lock-free ring and can be dumped in Chrome trace event format,
+* which both chrome://tracing and the Perfetto UI open directly.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/19
+*/
+
+
+#pragma once
+#include "ov_genai_common.h"
+
+/**
+ * @enum ov_genai_trace_span_e
+ * @ingroup ov_genai_trace_c_api
+ * @brief This enum contains the kinds of spans recorded by the tracer.
+ */
+typedef enum {
+    TRACE_GENERATE = 0,          //!< A whole generate call.
+    TRACE_TOKENIZATION = 1,      //!< Prompt tokenization, taken from RawPerfMetrics.
+    TRACE_DECODE_STEP = 2,       //!< One infer + sampling step ending with a new token, taken from RawPerfMetrics.
+    TRACE_DETOKENIZATION = 3,    //!< Detokenization of the results, taken from RawPerfMetrics.
+    TRACE_STREAMER_CALLBACK = 4, //!< One call of the user streamer callback.
+    TRACE_PIPELINE_STEP = 5,     //!< One ContinuousBatchingPipeline::step call.
+} ov_genai_trace_span_e;
+
+/**
+ * @brief Enables tracing and allocates the event ring.
+ * @ingroup ov_genai_trace_c_api
+ * @param capacity The number of spans kept in the ring, rounded up to a power of two, at most 4194304.
+ * The oldest spans are overwritten once the ring is full. A ring of another capacity replaces the current one
+ * and drops its spans.
+ * @return Status code of the operation: OK(0) for success, INVALID_C_PARAM for 0 or above the limit.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_trace_enable(size_t capacity);
+
+/**
+ * @brief Disables tracing. Already recorded spans are kept until ov_genai_trace_clear.
+ * @ingroup ov_genai_trace_c_api
+ */
+OPENVINO_C_API(void)
+ov_genai_trace_disable();
+
+/**
+ * @brief Checks whether tracing is enabled.
+ * @ingroup ov_genai_trace_c_api
+ * @return true if spans are being recorded.
+ */
+OPENVINO_C_API(bool)
+ov_genai_trace_is_enabled();
+
+/**
+ * @brief Drops every span recorded so far.
+ * @ingroup ov_genai_trace_c_api
+ */
+OPENVINO_C_API(void)
+ov_genai_trace_clear();
+
+/**
+ * @brief Dumps the recorded spans as Chrome trace event JSON, one track per request.
+ * @ingroup ov_genai_trace_c_api
+ * @param json A pointer to the newly allocated JSON text, free it with ov_genai_free.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_trace_dump_chrome_json(char** json);
+
+/**
+ * @brief Dumps the recorded spans as Chrome trace event JSON into a file.
+ * @ingroup ov_genai_trace_c_api
+ * @param file_path The path of the file to write.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_genai_trace_dump_chrome_json_to_file(const char* file_path);
@@ -13,4 +13,22 @@
 #include "openvino/openvino.hpp"
 #include "ov_genai_common.h"
 
-typedef struct ov_tensor ov_tensor_t;
\ No newline at end of file
+typedef struct ov_tensor ov_tensor_t;
+
+/**
+ * @brief Releases an ov_tensor_t, the ov::Tensor it wraps stays alive while another owner shares it.
+ * @ingroup ov_base_c_api
+ * @param tensor A pointer to the ov_tensor_t to free memory.
+ */
+OPENVINO_C_API(void)
+ov_tensor_free(ov_tensor_t* tensor);
+
+/**
+ * @brief Gets the number of elements of the tensor, the product of its shape.
+ * @ingroup ov_base_c_api
+ * @param tensor A pointer to the ov_tensor_t.
+ * @param elements_size The number of elements.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_tensor_get_size(const ov_tensor_t* tensor, size_t* elements_size);
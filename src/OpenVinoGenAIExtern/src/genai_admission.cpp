@@ -0,0 +1,70 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "genai_admission.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+// weight of the newest sample in the moving averages
+constexpr double average_weight = 0.2;
+
+void update_average(double& average, double sample) {
+    average = average == 0.0 ? sample : average + average_weight * (sample - average);
+}
+}  // namespace
+
+const char* genai_admission::check(float cache_usage, size_t prompt_tokens) const {
+    if (config.max_queued_requests && queue.size() >= config.max_queued_requests)
+        return "max_queued_requests";
+    // a request longer than the whole budget is still let in alone, or it could never run
+    if (config.max_queued_prompt_tokens && !queue.empty()
+        && queued_tokens + prompt_tokens > config.max_queued_prompt_tokens)
+        return "max_queued_prompt_tokens";
+    if (config.max_cache_usage > 0.0f && cache_usage >= config.max_cache_usage)
+        return "max_cache_usage";
+    return nullptr;
+}
+
+void genai_admission::enqueue(const ov::genai::GenerationHandle& handle, size_t prompt_tokens) {
+    queue.push_back({handle, prompt_tokens, std::chrono::steady_clock::now()});
+    queued_tokens += prompt_tokens;
+}
+
+void genai_admission::after_step(double step_ms) {
+    std::lock_guard<std::mutex> lock(mutex);
+    update_average(step_ms_avg, step_ms);
+    const auto now = std::chrono::steady_clock::now();
+    auto started = std::remove_if(queue.begin(), queue.end(), [&](const queued_request& request) {
+        std::shared_ptr<ov::genai::GenerationHandleImpl> handle = request.handle.lock();
+        // the outputs of the step are still unread here, a readable handle has its first token
+        bool first_token = handle && handle->can_read();
+        if (handle && !first_token && handle->get_status() == ov::genai::GenerationStatus::RUNNING)
+            return false;
+        if (first_token)
+            update_average(wait_ms_avg,
+                std::chrono::duration<double, std::milli>(now - request.admitted).count());
+        queued_tokens -= request.prompt_tokens;
+        return true;
+    });
+    queue.erase(started, queue.end());
+}
+
+uint64_t genai_admission::retry_after_ms() const {
+    // the head of the queue starts after about one queue wait, never sooner than a step
+    return static_cast<uint64_t>(std::ceil(std::max(step_ms_avg, wait_ms_avg)));
+}
+
+void genai_admission::get_state(ov_genai_admission_state_t* state, float cache_usage) {
+    std::lock_guard<std::mutex> lock(mutex);
+    state->queued_requests = queue.size();
+    state->queued_prompt_tokens = queued_tokens;
+    state->cache_usage = cache_usage;
+    state->retry_after_ms = retry_after_ms();
+}
+
+std::string genai_admission::rejection(const char* limit) const {
+    return std::string("The request is rejected by the admission control, ") + limit
+        + " is reached, retry after " + std::to_string(retry_after_ms()) + " ms";
+}
@@ -0,0 +1,81 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "genai_common.h"
+#include "ov_genai_continuous_batching_pipeline.h"
+
+/**
+ * @struct genai_admission
+ * @brief Admission control of a continuous batching pipeline.
+ * Tracks the requests which are admitted but have not produced their first token yet, the queue whose
+ * depth makes the time to first token grow, and rejects the requests that would take it over the limits.
+ * The step and queue wait durations are kept as moving averages to suggest a retry-after.
+ */
+struct genai_admission {
+    /**
+     * @brief A request admitted which has not produced its first token yet.
+     */
+    struct queued_request {
+        std::weak_ptr<ov::genai::GenerationHandleImpl> handle;
+        size_t prompt_tokens;
+        std::chrono::steady_clock::time_point admitted;
+    };
+
+    explicit genai_admission(const ov_genai_admission_config_t& config) : config(config) {}
+
+    const ov_genai_admission_config_t config;
+    std::mutex mutex;  //!< Held by the caller of check and enqueue, across the add_request in between.
+
+    /**
+     * @brief Checks a request against the limits, call it with mutex held.
+     * @param cache_usage The KV cache usage of the pipeline in percent.
+     * @param prompt_tokens The prompt length of the request, 0 when the token limit is not set.
+     * @return The name of the limit the request would exceed, nullptr when it is admitted.
+     */
+    const char* check(float cache_usage, size_t prompt_tokens) const;
+
+    /**
+     * @brief Queues an admitted request, call it with mutex held.
+     */
+    void enqueue(const ov::genai::GenerationHandle& handle, size_t prompt_tokens);
+
+    /**
+     * @brief Removes the requests that have started or ended and updates the averages. Called right after
+     * each step, before the outputs of the step are read.
+     * @param step_ms The duration of the step.
+     */
+    void after_step(double step_ms);
+
+    /**
+     * @brief Fills the current state, takes the mutex.
+     */
+    void get_state(ov_genai_admission_state_t* state, float cache_usage);
+
+    /**
+     * @brief Formats the message of a rejection, call it with mutex held.
+     */
+    std::string rejection(const char* limit) const;
+
+    /**
+     * @brief Whether check needs the prompt length of the request.
+     */
+    bool counts_prompt_tokens() const {
+        return config.max_queued_prompt_tokens != 0;
+    }
+
+private:
+    uint64_t retry_after_ms() const;
+
+    std::vector<queued_request> queue;
+    size_t queued_tokens = 0;
+    double step_ms_avg = 0.0;  //!< Moving average of the step duration.
+    double wait_ms_avg = 0.0;  //!< Moving average of the time from admission to the first token.
+};
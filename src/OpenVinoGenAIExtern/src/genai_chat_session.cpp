@@ -0,0 +1,196 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "genai_chat_session.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace {
+constexpr char blob_magic[8] = {'O', 'V', 'G', 'A', 'I', 'C', 'H', '1'};
+
+void write_string(std::vector<char>& out, const std::string& value) {
+    uint32_t size = static_cast<uint32_t>(value.size());
+    const char* bytes = reinterpret_cast<const char*>(&size);
+    out.insert(out.end(), bytes, bytes + sizeof(size));
+    out.insert(out.end(), value.begin(), value.end());
+}
+
+bool read_string(const char* blob, size_t size, size_t& offset, std::string& value) {
+    uint32_t length = 0;
+    if (size - offset < sizeof(length))
+        return false;
+    std::memcpy(&length, blob + offset, sizeof(length));
+    offset += sizeof(length);
+    if (size - offset < length)
+        return false;
+    value.assign(blob + offset, length);
+    offset += length;
+    return true;
+}
+
+const std::string& field(const std::map<std::string, std::string>& message, const std::string& name) {
+    static const std::string missing;
+    auto found = message.find(name);
+    return found == message.end() ? missing : found->second;
+}
+}  // namespace
+
+std::string genai_chat_session::templated_prompt(const ov::genai::Tokenizer& tokenizer, const std::string& message) const {
+    ov::genai::ChatHistory turn = snapshot();
+    turn.push_back({{"role", "user"}, {"content", message}});
+    return tokenizer.apply_chat_template(turn, true);
+}
+
+void genai_chat_session::add_turn(const std::string& message, const std::string& answer) {
+    std::lock_guard<std::mutex> lock(mutex);
+    history.push_back({{"role", "user"}, {"content", message}});
+    history.push_back({{"role", "assistant"}, {"content", answer}});
+}
+
+ov::genai::ChatHistory genai_chat_session::snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return history;
+}
+
+std::vector<char> genai_serialize_chat(const ov::genai::ChatHistory& history) {
+    std::vector<char> blob(blob_magic, blob_magic + sizeof(blob_magic));
+    uint32_t count = static_cast<uint32_t>(history.size());
+    const char* bytes = reinterpret_cast<const char*>(&count);
+    blob.insert(blob.end(), bytes, bytes + sizeof(count));
+    for (const auto& message : history) {
+        write_string(blob, field(message, "role"));
+        write_string(blob, field(message, "content"));
+    }
+    return blob;
+}
+
+ov::genai::ChatHistory genai_deserialize_chat(const char* blob, size_t size) {
+    uint32_t count = 0;
+    if (size < sizeof(blob_magic) + sizeof(count) || std::memcmp(blob, blob_magic, sizeof(blob_magic)) != 0)
+        OPENVINO_THROW("Not a chat session blob");
+    std::memcpy(&count, blob + sizeof(blob_magic), sizeof(count));
+    size_t offset = sizeof(blob_magic) + sizeof(count);
+    ov::genai::ChatHistory history;
+    for (uint32_t i = 0; i < count; ++i) {
+        std::string role, content;
+        if (!read_string(blob, size, offset, role) || !read_string(blob, size, offset, content))
+            OPENVINO_THROW("The chat session blob is cut");
+        history.push_back({{"role", std::move(role)}, {"content", std::move(content)}});
+    }
+    return history;
+}
+
+genai_chat_sessions::genai_chat_sessions(const ov_genai_chat_sessions_config_t& config)
+    : max_sessions(config.max_sessions),
+      idle_time(config.idle_ms),
+      snapshot_dir(config.snapshot_dir ? config.snapshot_dir : "") {}
+
+std::shared_ptr<genai_chat_session> genai_chat_sessions::open(const std::string& id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::shared_ptr<genai_chat_session> session;
+    auto found = sessions.find(id);
+    if (found != sessions.end()) {
+        lru.splice(lru.begin(), lru, found->second);
+        session = lru.front();
+    } else {
+        session = read_snapshot(id);
+        if (!session) {
+            session = std::make_shared<genai_chat_session>();
+            session->id = id;
+        }
+        // a session coming back has no KV cache in the pipeline, its next turn prefills it
+        session->native = false;
+        lru.push_front(session);
+        sessions[id] = lru.begin();
+        // without a snapshot directory memory holds the only copy of the messages, the sessions stay and the
+        // bound is left to the KV cache, which the pipeline keeps for the latest session only
+        while (max_sessions && !snapshot_dir.empty() && lru.size() > max_sessions) {
+            write_snapshot(*lru.back());
+            sessions.erase(lru.back()->id);
+            lru.pop_back();
+        }
+    }
+    session->last_used = std::chrono::steady_clock::now();
+    return session;
+}
+
+void genai_chat_sessions::end(const std::string& id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto found = sessions.find(id);
+    if (found != sessions.end()) {
+        lru.erase(found->second);
+        sessions.erase(found);
+    }
+    if (!snapshot_dir.empty())
+        std::remove(snapshot_path(id).c_str());
+}
+
+bool genai_chat_sessions::idle(const genai_chat_session& session) const {
+    return idle_time.count() && std::chrono::steady_clock::now() - session.last_used > idle_time;
+}
+
+void genai_chat_sessions::count_turn(bool re_prefill) {
+    std::lock_guard<std::mutex> lock(mutex);
+    ++stats.turns;
+    if (re_prefill)
+        ++stats.re_prefills;
+}
+
+void genai_chat_sessions::count_eviction() {
+    std::lock_guard<std::mutex> lock(mutex);
+    ++stats.evictions;
+}
+
+void genai_chat_sessions::get_stats(ov_genai_chat_sessions_stats_t* out, size_t resident) {
+    std::lock_guard<std::mutex> lock(mutex);
+    *out = stats;
+    out->sessions = lru.size();
+    out->resident = resident;
+}
+
+std::string genai_chat_sessions::snapshot_path(const std::string& id) const {
+    // FNV-1a of the id, any id makes a valid file name
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : id) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.chat", static_cast<unsigned long long>(hash));
+    return snapshot_dir + "/" + name;
+}
+
+void genai_chat_sessions::write_snapshot(const genai_chat_session& session) {
+    if (snapshot_dir.empty())
+        return;
+    // the file starts with the id, two ids of one hash do not read each other back
+    std::vector<char> blob;
+    write_string(blob, session.id);
+    std::vector<char> chat = genai_serialize_chat(session.snapshot());
+    blob.insert(blob.end(), chat.begin(), chat.end());
+    std::ofstream file(snapshot_path(session.id), std::ios::binary | std::ios::trunc);
+    if (!file.write(blob.data(), blob.size()))
+        OPENVINO_THROW("Cannot write the chat session snapshot of ", session.id);
+    ++stats.snapshots_written;
+}
+
+std::shared_ptr<genai_chat_session> genai_chat_sessions::read_snapshot(const std::string& id) {
+    if (snapshot_dir.empty())
+        return nullptr;
+    std::ifstream file(snapshot_path(id), std::ios::binary);
+    if (!file)
+        return nullptr;
+    std::vector<char> blob((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    size_t offset = 0;
+    std::string stored_id;
+    if (!read_string(blob.data(), blob.size(), offset, stored_id) || stored_id != id)
+        return nullptr;
+    auto session = std::make_shared<genai_chat_session>();
+    session->id = id;
+    session->history = genai_deserialize_chat(blob.data() + offset, blob.size() - offset);
+    ++stats.snapshots_restored;
+    return session;
+}
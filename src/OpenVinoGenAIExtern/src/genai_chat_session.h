@@ -0,0 +1,98 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "genai_common.h"
+
+/**
+ * @struct genai_chat_session
+ * @brief The chat of an LLMPipeline between start_chat and finish_chat, as the wrapper tracks it to export it.
+ * A session started on the pipeline is native: the pipeline keeps its own history and KV cache across the turns.
+ * An imported session is not, the pipeline is out of its chat mode and every turn is prefilled from the whole
+ * history, templated by the tokenizer.
+ */
+struct genai_chat_session {
+    ov::genai::ChatHistory history;  //!< The messages, each with a role and a content. Guarded by mutex.
+    bool native = true;
+    std::string id;  //!< The id of the session in a genai_chat_sessions, empty for the chat of the pipeline.
+    std::chrono::steady_clock::time_point last_used = std::chrono::steady_clock::now();
+    mutable std::mutex mutex;
+
+    /**
+     * @brief The prompt of the next turn of a session which is not native: the history and the message, templated.
+     */
+    std::string templated_prompt(const ov::genai::Tokenizer& tokenizer, const std::string& message) const;
+
+    /**
+     * @brief Adds a turn once the pipeline has answered it.
+     */
+    void add_turn(const std::string& message, const std::string& answer);
+
+    /**
+     * @brief A copy of the history, the turns may be added on another thread.
+     */
+    ov::genai::ChatHistory snapshot() const;
+};
+
+/**
+ * @brief Serializes a chat history into a blob for genai_deserialize_chat.
+ */
+std::vector<char> genai_serialize_chat(const ov::genai::ChatHistory& history);
+
+/**
+ * @brief Reads back a blob of genai_serialize_chat, throws when it is not one.
+ */
+ov::genai::ChatHistory genai_deserialize_chat(const char* blob, size_t size);
+
+/**
+ * @struct genai_chat_sessions
+ * @brief The chat sessions of a pipeline by id. Beyond max_sessions the least recently used session leaves memory
+ * into a snapshot file of the config directory, from which the next turn of the session reads it back. Without a
+ * directory the sessions stay in memory. Which sessions hold a KV cache is up to the pipeline, the sessions only
+ * count the evictions and re-prefills.
+ */
+struct genai_chat_sessions {
+    explicit genai_chat_sessions(const ov_genai_chat_sessions_config_t& config);
+
+    /**
+     * @brief The session of an id, created or read back from its snapshot, marked as used now.
+     */
+    std::shared_ptr<genai_chat_session> open(const std::string& id);
+
+    /**
+     * @brief Forgets a session and its snapshot.
+     */
+    void end(const std::string& id);
+
+    /**
+     * @brief Whether a session has been idle for longer than the config allows to a session holding a KV cache.
+     */
+    bool idle(const genai_chat_session& session) const;
+
+    void count_turn(bool re_prefill);
+    void count_eviction();
+    void get_stats(ov_genai_chat_sessions_stats_t* stats, size_t resident);
+
+private:
+    std::string snapshot_path(const std::string& id) const;
+    void write_snapshot(const genai_chat_session& session);
+    std::shared_ptr<genai_chat_session> read_snapshot(const std::string& id);
+
+    std::mutex mutex;
+    const size_t max_sessions;
+    const std::chrono::milliseconds idle_time;
+    const std::string snapshot_dir;
+    std::list<std::shared_ptr<genai_chat_session>> lru;  //!< Most recently used first.
+    std::unordered_map<std::string, std::list<std::shared_ptr<genai_chat_session>>::iterator> sessions;
+    ov_genai_chat_sessions_stats_t stats{};
+};
@@ -0,0 +1,207 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "genai_coalescing.h"
+
+#include <chrono>
+
+namespace {
+// how long a blocking read sleeps between two looks at the pipeline, nothing notifies it of a step
+constexpr std::chrono::milliseconds read_poll_interval(1);
+
+template <typename T>
+void append_field(std::string& key, const T& value) {
+    key += std::to_string(value);
+    key += '\x1f';
+}
+}  // namespace
+
+std::string genai_request_key(const std::string& prompt, const ov::genai::GenerationConfig& config) {
+    // sampling, beams and several sequences give outputs that are not a function of the prompt
+    if (!config.is_greedy_decoding() || config.num_return_sequences != 1)
+        return {};
+    std::string key;
+    append_field(key, config.max_new_tokens);
+    append_field(key, config.max_length);
+    append_field(key, config.min_new_tokens);
+    append_field(key, config.ignore_eos);
+    append_field(key, config.eos_token_id);
+    append_field(key, config.include_stop_str_in_output);
+    append_field(key, config.repetition_penalty);
+    append_field(key, config.presence_penalty);
+    append_field(key, config.frequency_penalty);
+    append_field(key, config.no_repeat_ngram_size);
+    append_field(key, config.logprobs);
+    append_field(key, config.num_assistant_tokens);
+    append_field(key, config.assistant_confidence_threshold);
+    append_field(key, config.max_ngram_size);
+    append_field(key, config.stop_token_ids.size());
+    for (int64_t token : config.stop_token_ids)
+        append_field(key, token);
+    append_field(key, config.stop_strings.size());
+    for (const std::string& stop : config.stop_strings) {
+        append_field(key, stop.size());
+        key += stop;
+    }
+    key += '\x1e';
+    key += prompt;
+    return key;
+}
+
+ov::genai::GenerationStatus genai_coalesced_request::status() {
+    return object ? object->get_status() : ov::genai::GenerationStatus::FINISHED;
+}
+
+void genai_coalesced_request::pull() {
+    if (!object)
+        return;
+    bool added = false;
+    while (object->can_read()) {
+        ov::genai::GenerationOutputs outputs = object->read();
+        if (outputs.empty())
+            continue;
+        const ov::genai::GenerationOutput& output = outputs.begin()->second;
+        sequence_id = outputs.begin()->first;
+        generated_ids.insert(generated_ids.end(), output.generated_ids.begin(), output.generated_ids.end());
+        generated_log_probs.insert(generated_log_probs.end(), output.generated_log_probs.begin(),
+            output.generated_log_probs.end());
+        score = output.score;
+        finish_reason = output.finish_reason;
+        added = true;
+    }
+    if (on_finished && object->get_status() == ov::genai::GenerationStatus::FINISHED && !object->can_read()) {
+        on_finished(*this);
+        on_finished = nullptr;
+    }
+    if (added)
+        pulled.notify_all();
+}
+
+bool genai_coalesced_request::ended() {
+    return !object || (object->get_status() != ov::genai::GenerationStatus::RUNNING && !object->can_read());
+}
+
+genai_subscription::genai_subscription(std::shared_ptr<genai_coalesced_request> request)
+    : request(std::move(request)) {}
+
+genai_subscription::~genai_subscription() {
+    // as the GenerationHandle of a request, freeing the handle lets go of the request
+    drop();
+}
+
+ov::genai::GenerationStatus genai_subscription::status() {
+    std::lock_guard<std::mutex> lock(request->mutex);
+    return dropped ? ov::genai::GenerationStatus::DROPPED_BY_HANDLE : request->status();
+}
+
+bool genai_subscription::can_read() {
+    std::lock_guard<std::mutex> lock(request->mutex);
+    request->pull();
+    return !dropped && cursor < request->generated_ids.size();
+}
+
+ov::genai::GenerationOutputs genai_subscription::pending(size_t from) {
+    ov::genai::GenerationOutputs outputs;
+    if (from >= request->generated_ids.size() && !request->ended())
+        return outputs;
+    ov::genai::GenerationOutput& output = outputs[request->sequence_id];
+    output.generated_ids.assign(request->generated_ids.begin() + from, request->generated_ids.end());
+    if (from < request->generated_log_probs.size()) {
+        output.generated_log_probs.assign(request->generated_log_probs.begin() + from,
+            request->generated_log_probs.end());
+    }
+    output.score = request->score;
+    output.finish_reason = request->finish_reason;
+    return outputs;
+}
+
+ov::genai::GenerationOutputs genai_subscription::back() {
+    std::lock_guard<std::mutex> lock(request->mutex);
+    request->pull();
+    return pending(cursor);
+}
+
+ov::genai::GenerationOutputs genai_subscription::read(bool block) {
+    std::unique_lock<std::mutex> lock(request->mutex);
+    request->pull();
+    while (block && !dropped && cursor == request->generated_ids.size() && !request->ended()) {
+        request->pulled.wait_for(lock, read_poll_interval);
+        request->pull();
+    }
+    if (dropped || cursor == request->generated_ids.size())
+        return {};
+    ov::genai::GenerationOutputs outputs = pending(cursor);
+    cursor = request->generated_ids.size();
+    return outputs;
+}
+
+std::vector<ov::genai::GenerationOutput> genai_subscription::read_all() {
+    std::unique_lock<std::mutex> lock(request->mutex);
+    request->pull();
+    while (!dropped && !request->ended()) {
+        request->pulled.wait_for(lock, read_poll_interval);
+        request->pull();
+    }
+    cursor = request->generated_ids.size();
+    std::vector<ov::genai::GenerationOutput> outputs;
+    for (auto& output : pending(0))
+        outputs.push_back(std::move(output.second));
+    return outputs;
+}
+
+bool genai_subscription::finished() {
+    std::lock_guard<std::mutex> lock(request->mutex);
+    request->pull();
+    return dropped || (request->ended() && cursor == request->generated_ids.size());
+}
+
+void genai_subscription::drop() {
+    std::lock_guard<std::mutex> lock(request->mutex);
+    if (dropped)
+        return;
+    dropped = true;
+    if (--request->subscribers == 0 && request->object)
+        request->object->drop();
+}
+
+std::shared_ptr<genai_subscription> genai_coalescer::join(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto found = in_flight.find(key);
+    if (found == in_flight.end())
+        return nullptr;
+    std::shared_ptr<genai_coalesced_request> request = found->second.lock();
+    if (request) {
+        std::lock_guard<std::mutex> request_lock(request->mutex);
+        // a request every handle has dropped, or one over, is not joined any more
+        if (request->subscribers && request->status() == ov::genai::GenerationStatus::RUNNING) {
+            ++request->subscribers;
+            ++joined;
+            return std::make_shared<genai_subscription>(request);
+        }
+    }
+    in_flight.erase(found);
+    return nullptr;
+}
+
+std::shared_ptr<genai_subscription> genai_subscribe(std::shared_ptr<genai_coalesced_request> request) {
+    request->subscribers = 1;
+    return std::make_shared<genai_subscription>(std::move(request));
+}
+
+std::shared_ptr<genai_subscription> genai_coalescer::lead(const std::string& key,
+    std::shared_ptr<genai_coalesced_request> request) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = in_flight.begin(); it != in_flight.end();) {
+        if (it->second.expired())
+            it = in_flight.erase(it);
+        else
+            ++it;
+    }
+    in_flight[key] = request;
+    return genai_subscribe(std::move(request));
+}
+
+uint64_t genai_coalescer::joined_requests() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return joined;
+}
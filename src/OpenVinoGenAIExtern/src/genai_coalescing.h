@@ -0,0 +1,124 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "genai_common.h"
+
+/**
+ * @brief The key of a request whose outputs only depend on its prompt and config, empty when they do not.
+ * Covers the greedy requests of one sequence, and every field of the config that changes their tokens.
+ */
+std::string genai_request_key(const std::string& prompt, const ov::genai::GenerationConfig& config);
+
+/**
+ * @struct genai_coalesced_request
+ * @brief A request of the pipeline shared by the handles of identical requests.
+ * The outputs read from the pipeline are kept from the first token on, so that a handle subscribing late
+ * reads the whole sequence as well. A request without object replays outputs kept from before, it is
+ * finished from the start.
+ */
+struct genai_coalesced_request {
+    explicit genai_coalesced_request(ov::genai::GenerationHandle object) : object(std::move(object)) {}
+
+    std::mutex mutex;
+    std::condition_variable pulled;  //!< Notified when outputs are taken from the pipeline.
+    const ov::genai::GenerationHandle object;  //!< Null for a replay.
+    uint64_t sequence_id = 0;
+    std::vector<int64_t> generated_ids;
+    std::vector<float> generated_log_probs;
+    float score = 0.0f;
+    ov::genai::GenerationFinishReason finish_reason = ov::genai::GenerationFinishReason::NONE;
+    size_t subscribers = 0;  //!< The handles not dropped, the last one to drop drops the request.
+    //! Called once, with mutex held, when all the outputs of a request the pipeline finished are taken.
+    std::function<void(const genai_coalesced_request&)> on_finished;
+
+    ov::genai::GenerationStatus status();
+
+    /**
+     * @brief Takes the outputs the pipeline has ready, call it with mutex held.
+     */
+    void pull();
+
+    /**
+     * @brief Whether the pipeline has ended the request and every output has been taken, call it with mutex held.
+     */
+    bool ended();
+};
+
+/**
+ * @struct genai_subscription
+ * @brief The view of one handle on a coalesced request, with its own read position. The reads follow
+ * the ones of ov::genai::GenerationHandleImpl.
+ */
+struct genai_subscription {
+    explicit genai_subscription(std::shared_ptr<genai_coalesced_request> request);
+    ~genai_subscription();
+
+    ov::genai::GenerationStatus status();
+    bool can_read();
+    ov::genai::GenerationOutputs back();
+
+    /**
+     * @brief Reads the outputs not read yet.
+     * @param block Whether to wait for an output while the request is running.
+     */
+    ov::genai::GenerationOutputs read(bool block);
+
+    /**
+     * @brief Waits for the end of the request and returns the whole sequence.
+     */
+    std::vector<ov::genai::GenerationOutput> read_all();
+
+    /**
+     * @brief Whether the request is over for this handle, with nothing left to read.
+     */
+    bool finished();
+
+    void drop();
+
+private:
+    ov::genai::GenerationOutputs pending(size_t from);
+
+    const std::shared_ptr<genai_coalesced_request> request;
+    size_t cursor = 0;
+    bool dropped = false;
+};
+
+/**
+ * @brief Subscribes the first handle to a request no other handle can join.
+ */
+std::shared_ptr<genai_subscription> genai_subscribe(std::shared_ptr<genai_coalesced_request> request);
+
+/**
+ * @struct genai_coalescer
+ * @brief The coalesced requests of a pipeline still running, by key.
+ */
+struct genai_coalescer {
+    /**
+     * @brief Subscribes to the running request of the key, null when there is none.
+     */
+    std::shared_ptr<genai_subscription> join(const std::string& key);
+
+    /**
+     * @brief Makes a request just added the one to join for its key, and subscribes to it.
+     */
+    std::shared_ptr<genai_subscription> lead(const std::string& key, std::shared_ptr<genai_coalesced_request> request);
+
+    /**
+     * @brief The number of requests served by joining another one.
+     */
+    uint64_t joined_requests();
+
+private:
+    std::mutex mutex;
+    std::unordered_map<std::string, std::weak_ptr<genai_coalesced_request>> in_flight;
+    uint64_t joined = 0;
+};
@@ -3,6 +3,41 @@
 //
 #include "genai_common.h"
 
+ov::AnyMap properties_from_args_list(va_list& args_ptr, std::exception_ptr& error) {
+    ov::AnyMap property = {};
+    try {
+        for (const char* property_key = va_arg(args_ptr, const char*); property_key != nullptr;
+            property_key = va_arg(args_ptr, const char*)) {
+            const char* value = va_arg(args_ptr, const char*);
+            if (!value)
+                OPENVINO_THROW("The property ", property_key, " has no value, properties are key and value pairs ending with NULL");
+            property[property_key] = std::string(value);
+        }
+    }
+    catch (...) {
+        error = std::current_exception();
+    }
+    return property;
+}
+
+ov::AnyMap properties_from_args_list(va_list& args_ptr, size_t count, std::exception_ptr& error) {
+    ov::AnyMap property = {};
+    try {
+        for (size_t i = 0; i < count; ++i) {
+            const char* property_key = va_arg(args_ptr, const char*);
+            const char* value = va_arg(args_ptr, const char*);
+            if (!property_key || !value)
+                OPENVINO_THROW("The property ", i, " has no key or no value");
+            property[property_key] = std::string(value);
+        }
+    }
+    catch (...) {
+        if (!error)
+            error = std::current_exception();
+    }
+    return property;
+}
+
 std::vector<std::string> char_arrays_to_str_array(const ov_genai_char_arrays_t inputs_array) {
     std::vector<std::string> strs;
     for (int i = 0; i < inputs_array.size; ++i)
@@ -31,6 +66,46 @@ ov_genai_double_int_arrays_t int_vectors_to__double_int_arrays(std::vector<std::
     return arrays;
 }
 
+ov::genai::StreamerVariant streamer_to_streamer_variant(const ov_genai_streamer_t* streamer) {
+    ov_genai_streamer_t copy = *streamer;
+    return std::function<bool(std::string)>([copy](std::string word) {
+        return copy.callback(word.data(), word.size(), copy.user_data);
+    });
+}
+
+bool genai_text_stream::put(int64_t token) {
+    tokens.push_back(token);
+    std::string text = tokenizer.decode(tokens);
+    if (!text.empty() && text.back() == '\n' && text.size() > printed) {
+        // a finished line, restart the decoding window so it does not grow with the answer
+        std::string piece = text.substr(printed);
+        tokens.clear();
+        printed = 0;
+        return streamer.callback(piece.data(), piece.size(), streamer.user_data);
+    }
+    // U+FFFD at the end, the last token ends in the middle of a character
+    if (text.size() >= 3 && text.compare(text.size() - 3, 3, "\xEF\xBF\xBD") == 0)
+        return false;
+    if (text.size() <= printed)
+        return false;
+    std::string piece = text.substr(printed);
+    printed = text.size();
+    return streamer.callback(piece.data(), piece.size(), streamer.user_data);
+}
+
+void genai_text_stream::end() {
+    if (ended)
+        return;
+    ended = true;
+    if (tokens.empty())
+        return;
+    std::string text = tokenizer.decode(tokens);
+    tokens.clear();
+    if (text.size() > printed)
+        streamer.callback(text.data() + printed, text.size() - printed, streamer.user_data);
+    printed = 0;
+}
+
 size_t timepoint_to_nanoseconds(std::chrono::steady_clock::time_point timepoint) {
     return std::chrono::duration_cast<std::chrono::nanoseconds>(timepoint.time_since_epoch()).count();
 }
@@ -50,17 +125,33 @@ char* str_to_char_array(const std::string& str) {
     return char_array;
 }
 
-static std::string last_err_msg;
-static std::mutex last_msg_mutex;
+// each thread keeps its own last error, a failing call never waits on another thread or overwrites its error
+static thread_local std::string last_err_msg;
+static thread_local ov_status_e last_err_status = ov_status_e::OK;
+void set_last_err(ov_status_e status, const char* msg) {
+    last_err_status = status;
+    last_err_msg = msg ? msg : "";
+}
 void dup_last_err_msg(const char* msg) {
-    std::lock_guard<std::mutex> lock(last_msg_mutex);
-    last_err_msg = std::string(msg);
+    set_last_err(ov_status_e::GENERAL_ERROR, msg);
 }
 const char* ov_genai_get_last_err_msg() {
-    std::lock_guard<std::mutex> lock(last_msg_mutex);
     char* res = nullptr;
     if (!last_err_msg.empty()) {
         res = str_to_char_array(last_err_msg);
     }
     return res;
 }
+ov_status_e ov_genai_get_last_err_msg_view(ov_status_e* status, const char** msg, size_t* length) {
+    if (!msg) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    if (status) {
+        *status = last_err_status;
+    }
+    *msg = last_err_msg.c_str();
+    if (length) {
+        *length = last_err_msg.length();
+    }
+    return ov_status_e::OK;
+}
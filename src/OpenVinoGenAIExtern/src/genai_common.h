@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 #pragma once
+#include <atomic>
 #include <cassert>
+#include <cstdarg>
+#include <exception>
 #include <fstream>
 #include <iterator>
 #include <map>
@@ -25,7 +28,7 @@
 
 #define CATCH_OV_GENAI_EXCEPTION(StatusCode, ExceptionType) \
     catch (const ov::ExceptionType& ex) {             \
-        dup_last_err_msg(ex.what());                  \
+        set_last_err(ov_status_e::StatusCode, ex.what()); \
         return ov_status_e::StatusCode;               \
     }
 
@@ -35,17 +38,10 @@
     CATCH_OV_GENAI_EXCEPTION(NOT_IMPLEMENTED, NotImplemented)    \
     CATCH_OV_GENAI_EXCEPTION(GENERAL_ERROR, Exception)           \
     catch (...) {                                          \
-        dup_last_err_msg("An unknown exception occurred"); \
+        set_last_err(ov_status_e::UNKNOW_EXCEPTION, "An unknown exception occurred"); \
         return ov_status_e::UNKNOW_EXCEPTION;              \
     }
 
-#define GET_PROPERTY_FROM_ARGS_LIST                     \
-    std::string property_key = va_arg(args_ptr, char*); \
-    std::string _value = va_arg(args_ptr, char*);       \
-    ov::Any value = _value;                             \
-    property[property_key] = value;
-
-
 
 
 struct ov_infer_request {
@@ -95,8 +91,52 @@ struct ov_genai_decoded_results {
 * @brief  This is an interface of ov::genai::LLMPipeline.
 * This class is used for generation with LLMs.
 */
+struct genai_chat_session;
+struct genai_chat_sessions;
+struct genai_completion_cache;
+struct genai_speculative_counters;
 struct ov_genai_llm_pipeline {
     std::shared_ptr<ov::genai::LLMPipeline> object;
+    std::shared_ptr<std::atomic<bool>> cancelled;  //!< Set by ov_genai_llm_pipeline_set_cancellation_token.
+    std::shared_ptr<genai_completion_cache> completion_cache;  //!< Set by ov_genai_llm_pipeline_set_completion_cache.
+    //! The chat between start_chat and finish_chat, or an imported one, when the answers depend on the history.
+    std::shared_ptr<genai_chat_session> chat;
+    //! The chat sessions by id, created by the first turn of one. The chat of the pipeline is the one holding the KV cache.
+    std::shared_ptr<genai_chat_sessions> sessions;
+    //! The acceptance counters of a pipeline created with a draft model or with prompt lookup.
+    std::shared_ptr<genai_speculative_counters> speculative;
+};
+
+/**
+* @struct ov_genai_cancellation_token
+* @brief  A flag set by the caller, read between the decode steps of the generations it is attached to.
+*/
+struct ov_genai_cancellation_token {
+    std::shared_ptr<std::atomic<bool>> object;
+};
+
+/**
+ * @struct genai_cancellable_streamer
+ * @brief Stops the generation once the flag is set, forwarding the tokens to another streamer until then.
+ */
+struct genai_cancellable_streamer : ov::genai::StreamerBase {
+    std::shared_ptr<std::atomic<bool>> cancelled;
+    std::shared_ptr<ov::genai::StreamerBase> inner;
+
+    genai_cancellable_streamer(std::shared_ptr<std::atomic<bool>> cancelled,
+        std::shared_ptr<ov::genai::StreamerBase> inner)
+        : cancelled(std::move(cancelled)), inner(std::move(inner)) {}
+
+    bool put(int64_t token) override {
+        if (cancelled->load(std::memory_order_relaxed))
+            return true;
+        return inner && inner->put(token);
+    }
+
+    void end() override {
+        if (inner)
+            inner->end();
+    }
 };
 /**
 * @struct ov_genai_tokenizer
@@ -148,8 +188,25 @@ struct ov_genai_scheduler_config {
 * @struct ov_genai_continuous_batching_pipeline
 * @brief  This is an interface of ov::genai::SchedulerConfig.
 */
+struct genai_admission;
+struct genai_chat_sessions;
+struct genai_coalescer;
+struct genai_completion_cache;
+struct genai_request_scheduler;
 struct ov_genai_continuous_batching_pipeline {
     std::shared_ptr<ov::genai::ContinuousBatchingPipeline> object;
+    //! Requests added since the last step, not yet counted by get_metrics().
+    std::atomic<size_t> added_since_step{0};
+    //! The admission control, null when every request is admitted. Read and set with std::atomic_load/store.
+    std::shared_ptr<genai_admission> admission;
+    //! Orders the requests added with options, created by the first of them. Read and set with std::atomic_load/store.
+    std::shared_ptr<genai_request_scheduler> scheduler;
+    //! Shares the identical greedy requests in flight, null when they are not coalesced. Read and set with std::atomic_load/store.
+    std::shared_ptr<genai_coalescer> coalescer;
+    //! Replays the greedy requests seen before, null when there is none. Read and set with std::atomic_load/store.
+    std::shared_ptr<genai_completion_cache> completion_cache;
+    //! The chat sessions by id, created by the first turn of one. Read and set with std::atomic_load/store.
+    std::shared_ptr<genai_chat_sessions> sessions;
 };
 
 
@@ -187,16 +244,73 @@ struct ov_genai_generation_outputs {
 };
 
 
+typedef bool(__stdcall* ov_genai_streamer_callback_t)(std::string str);
+
+/**
+ * @brief Streamer callback, receives each new piece of text as UTF-8 bytes, not NUL terminated.
+ * @param text The text, valid during the call only.
+ * @param length The length of text in bytes.
+ * @param user_data The user_data of the ov_genai_streamer_t.
+ * @return true to stop the generation.
+ */
+typedef bool(OPENVINO_C_API_CALLBACK* ov_genai_stream_callback_t)(const char* text, size_t length, void* user_data);
+
+/**
+ * @struct ov_genai_streamer_t
+ * @ingroup ov_genai_llm_pipeline_c_api
+ * @brief A streamer callback and the state passed back to it, callable from any language.
+ */
+typedef struct {
+    ov_genai_stream_callback_t callback;
+    void* user_data;
+} ov_genai_streamer_t;
+
+/**
+ * @brief Convert a streamer structure to the streamer of ov::genai.
+ * @param streamer The streamer structure.
+ * @return The streamer calling streamer->callback.
+*/
+ov::genai::StreamerVariant streamer_to_streamer_variant(const ov_genai_streamer_t* streamer);
+
+/**
+ * @struct genai_text_stream
+ * @brief Decodes the tokens read from a GenerationHandle as they arrive and passes the new text to a streamer.
+ * A token completing no character yet is kept until the following tokens complete it.
+ */
+struct genai_text_stream {
+    ov_genai_streamer_t streamer;
+    ov::genai::Tokenizer tokenizer;
+    std::vector<int64_t> tokens;
+    size_t printed = 0;
+    bool ended = false;
+
+    genai_text_stream(const ov_genai_streamer_t& streamer, ov::genai::Tokenizer tokenizer)
+        : streamer(streamer), tokenizer(std::move(tokenizer)) {}
+
+    /**
+     * @brief Adds one token, returns true when the streamer asks to stop.
+     */
+    bool put(int64_t token);
+
+    /**
+     * @brief Passes the text still held back, once.
+     */
+    void end();
+};
+
 /**
 * @struct ov_genai_generation_handle
 * @brief  This is an interface of ov::genai::GenerationHandleImpl.
 */
+struct genai_scheduled_request;
+struct genai_subscription;
 struct ov_genai_generation_handle {
-    std::shared_ptr<ov::genai::GenerationHandleImpl> object;
+    std::shared_ptr<ov::genai::GenerationHandleImpl> object;  //!< Null for a scheduled or coalesced request.
+    std::shared_ptr<genai_text_stream> stream;  //!< Set by the add_request calls taking a streamer.
+    std::shared_ptr<genai_scheduled_request> scheduled;  //!< Set by add_request_with_options.
+    std::shared_ptr<genai_subscription> coalesced;  //!< Set for a request sharing the outputs of identical ones.
 };
 
-typedef bool(__stdcall* ov_genai_streamer_callback_t)(std::string str);
-
 /**
  * @struct ov_string_array
  * @ingroup ov_genai_llm_pipeline_c_api
@@ -208,6 +322,24 @@ typedef struct {
 } ov_genai_char_arrays_t;
 
 
+/**
+ * @brief Reads the optional properties of a create function: key and value strings in pairs, terminated by NULL.
+ * Nothing is thrown while the list is read, so that the caller reaches va_end; it throws the error afterwards.
+ * @param args_ptr The arguments following the last named parameter, started by the caller.
+ * @param error Set when a key has no value or the properties cannot be stored.
+ * @return The properties read.
+*/
+ov::AnyMap properties_from_args_list(va_list& args_ptr, std::exception_ptr& error);
+
+/**
+ * @brief Reads a known number of key and value pairs of a create function, as properties_from_args_list does.
+ * @param args_ptr The arguments, read on from where the previous call left them.
+ * @param count The number of pairs.
+ * @param error Set when a key has no value or the properties cannot be stored.
+ * @return The properties read.
+*/
+ov::AnyMap properties_from_args_list(va_list& args_ptr, size_t count, std::exception_ptr& error);
+
 /**
  * @brief Convert character array structure to string array.
  * @param char_arrays The character array structure.
@@ -289,5 +421,6 @@ struct mem_istream : virtual mem_stringbuf, std::istream {
 };
 
 char* str_to_char_array(const std::string& str);
+void set_last_err(ov_status_e status, const char* msg);
 void dup_last_err_msg(const char* msg);
 
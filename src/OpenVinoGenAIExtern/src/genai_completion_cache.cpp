@@ -0,0 +1,356 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "genai_completion_cache.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace {
+constexpr char file_magic[8] = {'O', 'V', 'G', 'A', 'I', 'C', 'C', '2'};
+constexpr uint32_t record_magic = 0x43524543;  // "CERC"
+constexpr size_t min_disk_size = 64 * 1024;
+
+/**
+ * @brief The head of the file, followed by the model id padded to 8 bytes, then by the records up to end.
+ */
+struct file_header {
+    char magic[8];
+    uint64_t size;
+    uint64_t end;
+    uint64_t model_id_size;
+};
+
+/**
+ * @brief The head of a record, followed by the key and the value, padded to 8 bytes.
+ */
+struct record_header {
+    uint32_t magic;
+    uint32_t key_size;
+    uint64_t value_size;
+};
+
+size_t padded(size_t size) {
+    return (size + 7) & ~size_t(7);
+}
+
+// FNV-1a, the index of the file is rebuilt from it on every start and has to stay stable across builds
+uint64_t hash_key(const std::string& key) {
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : key) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+size_t completion_size(const std::string& key, const genai_completion& completion) {
+    return key.size() + completion.text.size() + completion.generated_ids.size() * sizeof(int64_t)
+        + completion.generated_log_probs.size() * sizeof(float) + sizeof(genai_completion);
+}
+
+template <typename T>
+void write_value(std::vector<uint8_t>& out, const T& value) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+void write_array(std::vector<uint8_t>& out, const T* data, size_t count) {
+    write_value(out, static_cast<uint64_t>(count));
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+    out.insert(out.end(), bytes, bytes + count * sizeof(T));
+}
+
+std::vector<uint8_t> serialize(const genai_completion& completion) {
+    std::vector<uint8_t> out;
+    write_array(out, completion.text.data(), completion.text.size());
+    write_array(out, completion.generated_ids.data(), completion.generated_ids.size());
+    write_array(out, completion.generated_log_probs.data(), completion.generated_log_probs.size());
+    write_value(out, completion.score);
+    write_value(out, completion.finish_reason);
+    return out;
+}
+
+struct reader {
+    const uint8_t* data;
+    size_t size;
+    size_t offset = 0;
+
+    template <typename T>
+    bool read_value(T& value) {
+        if (size - offset < sizeof(T))
+            return false;
+        std::memcpy(&value, data + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+
+    template <typename T, typename Container>
+    bool read_array(Container& out) {
+        uint64_t count = 0;
+        if (!read_value(count) || count > (size - offset) / sizeof(T))
+            return false;
+        out.resize(count);
+        if (count)
+            std::memcpy(&out[0], data + offset, count * sizeof(T));
+        offset += count * sizeof(T);
+        return true;
+    }
+};
+
+bool deserialize(const uint8_t* data, size_t size, genai_completion& completion) {
+    reader in{data, size};
+    return in.read_array<char>(completion.text) && in.read_array<int64_t>(completion.generated_ids)
+        && in.read_array<float>(completion.generated_log_probs) && in.read_value(completion.score)
+        && in.read_value(completion.finish_reason);
+}
+}  // namespace
+
+/**
+ * @struct genai_mapped_file
+ * @brief The mapped tier: a file header, then records appended up to the end of the file, indexed in memory
+ * by the hash of their key. A record which does not fit starts the log over.
+ */
+struct genai_mapped_file {
+    genai_mapped_file(const std::string& path, size_t size, const std::string& model_id);
+    ~genai_mapped_file();
+
+    bool get(const std::string& key, genai_completion& completion);
+    void put(const std::string& key, const genai_completion& completion);
+
+private:
+    file_header& header() {
+        return *reinterpret_cast<file_header*>(data);
+    }
+
+    void reset();
+    void load();
+    void close();
+
+    uint8_t* data = nullptr;
+    size_t size = 0;
+    std::string model_id;
+    uint64_t records = 0;  //!< The offset of the first record, past the model id.
+    std::unordered_multimap<uint64_t, uint64_t> index;  //!< Key hash to record offset.
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#else
+    int file = -1;
+#endif
+};
+
+genai_mapped_file::genai_mapped_file(const std::string& path, size_t requested, const std::string& model_id)
+    : size(std::max(requested, min_disk_size)), model_id(model_id),
+      records(sizeof(file_header) + padded(model_id.size())) {
+    if (records >= size)
+        OPENVINO_THROW("The completion cache file ", path, " is too small for the model id");
+#ifdef _WIN32
+    // no sharing, the cache holding the file is the only writer
+    file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_ALWAYS,
+        FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        if (GetLastError() == ERROR_SHARING_VIOLATION)
+            OPENVINO_THROW("The completion cache file ", path, " is used by another cache");
+        OPENVINO_THROW("Cannot open the completion cache file ", path);
+    }
+    LARGE_INTEGER current{};
+    GetFileSizeEx(file, &current);
+    bool fresh = static_cast<uint64_t>(current.QuadPart) != size;
+    if (fresh) {
+        LARGE_INTEGER target;
+        target.QuadPart = static_cast<LONGLONG>(size);
+        SetFilePointerEx(file, target, nullptr, FILE_BEGIN);
+        SetEndOfFile(file);
+    }
+    mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(uint64_t(size) >> 32),
+        static_cast<DWORD>(size & 0xFFFFFFFFu), nullptr);
+    if (mapping)
+        data = static_cast<uint8_t*>(MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size));
+    if (!data) {
+        if (mapping)
+            CloseHandle(mapping);
+        CloseHandle(file);
+        OPENVINO_THROW("Cannot map the completion cache file ", path);
+    }
+#else
+    file = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (file < 0)
+        OPENVINO_THROW("Cannot open the completion cache file ", path);
+    // the lock is released with the file, by the process or by its end
+    if (::flock(file, LOCK_EX | LOCK_NB) != 0) {
+        ::close(file);
+        OPENVINO_THROW("The completion cache file ", path, " is used by another cache");
+    }
+    struct stat status {};
+    ::fstat(file, &status);
+    bool fresh = static_cast<uint64_t>(status.st_size) != size;
+    void* mapped = MAP_FAILED;
+    if (!fresh || ::ftruncate(file, static_cast<off_t>(size)) == 0)
+        mapped = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    if (mapped == MAP_FAILED) {
+        ::close(file);
+        OPENVINO_THROW("Cannot map the completion cache file ", path);
+    }
+    data = static_cast<uint8_t*>(mapped);
+#endif
+    if (fresh || std::memcmp(header().magic, file_magic, sizeof(file_magic)) != 0 || header().size != size) {
+        reset();
+        return;
+    }
+    bool same_model = header().model_id_size == model_id.size()
+        && std::memcmp(data + sizeof(file_header), model_id.data(), model_id.size()) == 0;
+    if (!same_model) {
+        close();
+        OPENVINO_THROW("The completion cache file ", path, " holds the outputs of another model");
+    }
+    load();
+}
+
+genai_mapped_file::~genai_mapped_file() {
+    close();
+}
+
+void genai_mapped_file::close() {
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+    CloseHandle(mapping);
+    CloseHandle(file);
+#else
+    ::munmap(data, size);
+    ::close(file);
+#endif
+}
+
+void genai_mapped_file::reset() {
+    std::memcpy(header().magic, file_magic, sizeof(file_magic));
+    header().size = size;
+    header().model_id_size = model_id.size();
+    std::memset(data + sizeof(file_header), 0, records - sizeof(file_header));
+    std::memcpy(data + sizeof(file_header), model_id.data(), model_id.size());
+    header().end = records;
+    index.clear();
+}
+
+void genai_mapped_file::load() {
+    uint64_t end = std::min<uint64_t>(header().end, size);
+    uint64_t offset = records;
+    while (offset <= end && end - offset >= sizeof(record_header)) {
+        record_header record;
+        std::memcpy(&record, data + offset, sizeof(record));
+        uint64_t length = sizeof(record_header) + padded(record.key_size + record.value_size);
+        // a record cut by a crash ends the log
+        if (record.magic != record_magic || record.value_size > size || length > end - offset)
+            break;
+        std::string key(reinterpret_cast<const char*>(data + offset + sizeof(record_header)), record.key_size);
+        index.emplace(hash_key(key), offset);
+        offset += length;
+    }
+    header().end = offset;
+}
+
+bool genai_mapped_file::get(const std::string& key, genai_completion& completion) {
+    auto range = index.equal_range(hash_key(key));
+    for (auto it = range.first; it != range.second; ++it) {
+        record_header record;
+        std::memcpy(&record, data + it->second, sizeof(record));
+        const uint8_t* stored_key = data + it->second + sizeof(record_header);
+        if (record.key_size != key.size() || std::memcmp(stored_key, key.data(), key.size()) != 0)
+            continue;
+        return deserialize(stored_key + record.key_size, record.value_size, completion);
+    }
+    return false;
+}
+
+void genai_mapped_file::put(const std::string& key, const genai_completion& completion) {
+    std::vector<uint8_t> value = serialize(completion);
+    uint64_t length = sizeof(record_header) + padded(key.size() + value.size());
+    if (length > size - records)
+        return;
+    if (length > size - header().end)
+        reset();
+    uint64_t offset = header().end;
+    record_header record{record_magic, static_cast<uint32_t>(key.size()), value.size()};
+    std::memcpy(data + offset, &record, sizeof(record));
+    std::memcpy(data + offset + sizeof(record), key.data(), key.size());
+    std::memcpy(data + offset + sizeof(record) + key.size(), value.data(), value.size());
+    // the end moves last, a record is part of the log only once it is complete
+    header().end = offset + length;
+    index.emplace(hash_key(key), offset);
+}
+
+genai_completion_cache::genai_completion_cache(const ov_genai_completion_cache_config_t& config)
+    : model(config.model_id ? std::string(config.model_id) + '\x1d' : std::string()),
+      max_entries(config.max_entries), max_bytes(config.max_bytes) {
+    if (config.disk_path)
+        disk = std::make_unique<genai_mapped_file>(config.disk_path, config.disk_size,
+            config.model_id ? config.model_id : "");
+}
+
+genai_completion_cache::~genai_completion_cache() = default;
+
+std::shared_ptr<const genai_completion> genai_completion_cache::get(const std::string& request_key) {
+    const std::string key = model + request_key;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto found = entries.find(key);
+    if (found != entries.end()) {
+        lru.splice(lru.begin(), lru, found->second);
+        ++hits;
+        return found->second->second;
+    }
+    genai_completion completion;
+    if (disk && disk->get(key, completion)) {
+        ++disk_hits;
+        auto shared = std::make_shared<const genai_completion>(std::move(completion));
+        insert(key, shared);
+        return shared;
+    }
+    ++misses;
+    return nullptr;
+}
+
+void genai_completion_cache::put(const std::string& request_key, genai_completion completion) {
+    const std::string key = model + request_key;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (entries.count(key))
+        return;
+    auto shared = std::make_shared<const genai_completion>(std::move(completion));
+    if (disk)
+        disk->put(key, *shared);
+    insert(key, std::move(shared));
+}
+
+void genai_completion_cache::insert(const std::string& key, std::shared_ptr<const genai_completion> completion) {
+    bytes += completion_size(key, *completion);
+    lru.emplace_front(key, std::move(completion));
+    entries[key] = lru.begin();
+    while (!lru.empty() && ((max_entries && lru.size() > max_entries) || (max_bytes && bytes > max_bytes))) {
+        const entry& last = lru.back();
+        bytes -= completion_size(last.first, *last.second);
+        entries.erase(last.first);
+        lru.pop_back();
+    }
+}
+
+void genai_completion_cache::get_stats(ov_genai_completion_cache_stats_t* stats) {
+    std::lock_guard<std::mutex> lock(mutex);
+    stats->hits = hits;
+    stats->disk_hits = disk_hits;
+    stats->misses = misses;
+    stats->entries = lru.size();
+    stats->bytes = bytes;
+}
@@ -0,0 +1,72 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "genai_common.h"
+
+/**
+ * @struct genai_completion
+ * @brief The outputs of one finished greedy request. The LLMPipeline keeps the text, the continuous
+ * batching pipeline the tokens.
+ */
+struct genai_completion {
+    std::string text;
+    std::vector<int64_t> generated_ids;
+    std::vector<float> generated_log_probs;
+    float score = 0.0f;
+    int32_t finish_reason = 0;
+};
+
+struct genai_mapped_file;
+
+/**
+ * @struct genai_completion_cache
+ * @brief A bounded LRU of completions by request key, see genai_request_key, in front of an optional
+ * memory mapped file. The file is written through and looked up on a miss in memory, an entry found there
+ * is brought back into memory. The file is a log that starts over once full.
+ */
+struct genai_completion_cache {
+    /**
+     * @brief Opens the cache, and its file when the config has one. Throws when the file cannot be mapped,
+     * belongs to another model or is held by another cache.
+     */
+    explicit genai_completion_cache(const ov_genai_completion_cache_config_t& config);
+    ~genai_completion_cache();
+
+    /**
+     * @brief The completion of a key, null on a miss.
+     */
+    std::shared_ptr<const genai_completion> get(const std::string& key);
+
+    /**
+     * @brief Keeps the completion of a key.
+     */
+    void put(const std::string& key, genai_completion completion);
+
+    void get_stats(ov_genai_completion_cache_stats_t* stats);
+
+private:
+    using entry = std::pair<std::string, std::shared_ptr<const genai_completion>>;
+
+    void insert(const std::string& key, std::shared_ptr<const genai_completion> completion);
+
+    std::mutex mutex;
+    const std::string model;  //!< Prefixed to every key, the entries of another model never match.
+    const size_t max_entries;
+    const size_t max_bytes;
+    std::list<entry> lru;  //!< Most recently used first.
+    std::unordered_map<std::string, std::list<entry>::iterator> entries;
+    size_t bytes = 0;
+    std::unique_ptr<genai_mapped_file> disk;
+    uint64_t hits = 0;
+    uint64_t disk_hits = 0;
+    uint64_t misses = 0;
+};
@@ -0,0 +1,106 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "genai_prefix_snapshot.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "genai_common.h"
+
+namespace {
+constexpr char file_magic[8] = {'O', 'V', 'G', 'A', 'I', 'P', 'S', '1'};
+constexpr uint32_t record_magic = 0x58464550;  // "PEFX"
+
+/**
+ * @brief The head of a record, followed by the model id padded to 8 bytes and the token ids, so that the
+ * ids of a mapped file are aligned.
+ */
+struct record_header {
+    uint32_t magic;
+    uint32_t model_id_size;
+    uint64_t hash;
+    uint64_t token_count;
+};
+
+size_t padded(size_t size) {
+    return (size + 7) & ~size_t(7);
+}
+
+std::vector<genai_prefix_snapshot> read_all(const std::string& path) {
+    std::vector<genai_prefix_snapshot> snapshots;
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return snapshots;
+    std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (data.size() < sizeof(file_magic) || std::memcmp(data.data(), file_magic, sizeof(file_magic)) != 0)
+        OPENVINO_THROW("Not a prefix snapshot file: ", path);
+
+    size_t offset = sizeof(file_magic);
+    while (data.size() - offset >= sizeof(record_header)) {
+        record_header record;
+        std::memcpy(&record, data.data() + offset, sizeof(record));
+        size_t left = data.size() - offset - sizeof(record);
+        if (record.magic != record_magic || padded(record.model_id_size) > left
+            || record.token_count > (left - padded(record.model_id_size)) / sizeof(int64_t))
+            break;
+        const char* body = data.data() + offset + sizeof(record);
+        genai_prefix_snapshot snapshot;
+        snapshot.model_id.assign(body, record.model_id_size);
+        snapshot.hash = record.hash;
+        snapshot.input_ids.resize(record.token_count);
+        if (record.token_count)
+            std::memcpy(&snapshot.input_ids[0], body + padded(record.model_id_size), record.token_count * sizeof(int64_t));
+        snapshots.push_back(std::move(snapshot));
+        offset += sizeof(record) + padded(record.model_id_size) + record.token_count * sizeof(int64_t);
+    }
+    return snapshots;
+}
+}  // namespace
+
+uint64_t genai_token_hash(const std::vector<int64_t>& input_ids) {
+    uint64_t hash = 14695981039346656037ull;
+    for (int64_t id : input_ids) {
+        for (size_t i = 0; i < sizeof(id); ++i) {
+            hash ^= static_cast<uint8_t>(static_cast<uint64_t>(id) >> (i * 8));
+            hash *= 1099511628211ull;
+        }
+    }
+    return hash;
+}
+
+std::vector<genai_prefix_snapshot> genai_read_prefix_snapshots(const std::string& path, const std::string& model_id) {
+    std::vector<genai_prefix_snapshot> snapshots;
+    for (genai_prefix_snapshot& snapshot : read_all(path)) {
+        // a record whose ids do not match its hash was not written whole
+        if (snapshot.model_id == model_id && snapshot.hash == genai_token_hash(snapshot.input_ids))
+            snapshots.push_back(std::move(snapshot));
+    }
+    return snapshots;
+}
+
+bool genai_save_prefix_snapshot(const std::string& path, const genai_prefix_snapshot& snapshot) {
+    std::vector<genai_prefix_snapshot> existing = read_all(path);
+    for (const genai_prefix_snapshot& kept : existing) {
+        if (kept.model_id == snapshot.model_id && kept.hash == snapshot.hash && kept.input_ids == snapshot.input_ids)
+            return false;
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::app);
+    if (!file)
+        OPENVINO_THROW("Cannot open the prefix snapshot file ", path);
+    file.seekp(0, std::ios::end);
+    if (file.tellp() == std::streampos(0))
+        file.write(file_magic, sizeof(file_magic));
+    record_header record{record_magic, static_cast<uint32_t>(snapshot.model_id.size()), snapshot.hash,
+        snapshot.input_ids.size()};
+    const char padding[8] = {};
+    file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    file.write(snapshot.model_id.data(), snapshot.model_id.size());
+    file.write(padding, padded(snapshot.model_id.size()) - snapshot.model_id.size());
+    file.write(reinterpret_cast<const char*>(snapshot.input_ids.data()), snapshot.input_ids.size() * sizeof(int64_t));
+    if (!file.flush())
+        OPENVINO_THROW("Cannot write the prefix snapshot file ", path);
+    return true;
+}
@@ -0,0 +1,34 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct genai_prefix_snapshot
+ * @brief A prompt prefix kept for a model, to be prefilled again into the prefix cache of a new pipeline.
+ */
+struct genai_prefix_snapshot {
+    std::string model_id;
+    uint64_t hash = 0;  //!< See genai_token_hash.
+    std::vector<int64_t> input_ids;
+};
+
+/**
+ * @brief The hash of a token sequence, FNV-1a over the ids, stable across builds as the files keep it.
+ */
+uint64_t genai_token_hash(const std::vector<int64_t>& input_ids);
+
+/**
+ * @brief Reads the snapshots of a model from a file, none when the file does not exist. A record cut by a
+ * crash ends the file.
+ */
+std::vector<genai_prefix_snapshot> genai_read_prefix_snapshots(const std::string& path, const std::string& model_id);
+
+/**
+ * @brief Appends a snapshot to a file, creating it. Returns false when the file already holds it.
+ * Throws when the file cannot be written.
+ */
+bool genai_save_prefix_snapshot(const std::string& path, const genai_prefix_snapshot& snapshot);
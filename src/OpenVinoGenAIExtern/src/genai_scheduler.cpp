@@ -0,0 +1,247 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "genai_scheduler.h"
+
+#include <algorithm>
+
+namespace {
+// weight of the newest sample in the moving averages
+constexpr double average_weight = 0.2;
+
+void update_average(double& average, double sample) {
+    average = average == 0.0 ? sample : average + average_weight * (sample - average);
+}
+
+double elapsed_ms(std::chrono::steady_clock::time_point since) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - since).count();
+}
+}  // namespace
+
+std::shared_ptr<ov::genai::GenerationHandleImpl> genai_scheduled_request::untracked() {
+    std::lock_guard<std::mutex> lock(mutex);
+    preemptible = false;
+    return object;
+}
+
+ov::genai::GenerationStatus genai_scheduled_request::status() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (object)
+        return object->get_status();
+    return dropped ? ov::genai::GenerationStatus::DROPPED_BY_HANDLE : ov::genai::GenerationStatus::RUNNING;
+}
+
+void genai_scheduled_request::drop() {
+    dropped = true;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (object)
+        object->drop();
+}
+
+void genai_scheduled_request::record(const ov::genai::GenerationOutputs& outputs) {
+    for (const auto& output : outputs)
+        tokens_read += output.second.generated_ids.size();
+    if (!preemptible || outputs.empty())
+        return;
+    // several sequences cannot be folded back into one prompt
+    if (outputs.size() > 1) {
+        preemptible = false;
+        return;
+    }
+    const std::vector<int64_t>& ids = outputs.begin()->second.generated_ids;
+    generated.insert(generated.end(), ids.begin(), ids.end());
+}
+
+void genai_request_scheduler::set_config(const ov_genai_request_scheduler_config_t& config) {
+    std::lock_guard<std::mutex> lock(mutex);
+    this->config = config;
+}
+
+void genai_request_scheduler::set_weight(const std::string& tenant, float weight) {
+    std::lock_guard<std::mutex> lock(mutex);
+    tenants[tenant].weight = weight;
+}
+
+genai_tenant genai_request_scheduler::get_tenant(const std::string& tenant) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto found = tenants.find(tenant);
+    return found == tenants.end() ? genai_tenant{} : found->second;
+}
+
+void genai_request_scheduler::enqueue(const std::shared_ptr<genai_scheduled_request>& request) {
+    std::lock_guard<std::mutex> lock(mutex);
+    request->arrival = next_arrival++;
+    request->enqueued = std::chrono::steady_clock::now();
+    genai_tenant& tenant = tenants[request->tenant];
+    if (!tenant.queued && !tenant.running) {
+        // back from idle, level with the busy tenants
+        bool busy = false;
+        double least = 0.0;
+        for (const auto& other : tenants) {
+            if ((other.second.queued || other.second.running) && (!busy || other.second.virtual_time < least)) {
+                least = other.second.virtual_time;
+                busy = true;
+            }
+        }
+        tenant.virtual_time = std::max(tenant.virtual_time, least);
+    }
+    ++tenant.queued;
+    queued.push_back(request);
+}
+
+bool genai_request_scheduler::has_queued() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return !queued.empty();
+}
+
+bool genai_request_scheduler::runs_before(const genai_scheduled_request& a, const genai_scheduled_request& b) {
+    if (a.priority != b.priority)
+        return a.priority > b.priority;
+    if (a.deadline != b.deadline)
+        return a.deadline < b.deadline;
+    return a.arrival < b.arrival;
+}
+
+size_t genai_request_scheduler::next_queued() {
+    size_t next = 0;
+    for (size_t i = 1; i < queued.size(); ++i) {
+        const genai_scheduled_request& a = *queued[i];
+        const genai_scheduled_request& b = *queued[next];
+        if (a.priority != b.priority) {
+            if (a.priority > b.priority)
+                next = i;
+            continue;
+        }
+        double a_time = tenants[a.tenant].virtual_time;
+        double b_time = tenants[b.tenant].virtual_time;
+        if (a_time != b_time ? a_time < b_time : runs_before(a, b))
+            next = i;
+    }
+    return next;
+}
+
+void genai_request_scheduler::charge(genai_scheduled_request& request, size_t tokens) {
+    genai_tenant& tenant = tenants[request.tenant];
+    tenant.tokens_served += tokens;
+    tenant.virtual_time += tokens / static_cast<double>(tenant.weight);
+}
+
+void genai_request_scheduler::finish(genai_scheduled_request& request) {
+    genai_tenant& tenant = tenants[request.tenant];
+    --tenant.running;
+    ++tenant.requests_served;
+    update_average(tenant.avg_latency_ms, elapsed_ms(request.enqueued));
+}
+
+void genai_request_scheduler::release(ov::genai::ContinuousBatchingPipeline& pipeline,
+    const std::shared_ptr<genai_scheduled_request>& request) {
+    std::lock_guard<std::mutex> lock(request->mutex);
+    // a recomputed request goes on from the tokens its caller already has
+    std::vector<int64_t> ids = request->input_ids;
+    ids.insert(ids.end(), request->generated.begin(), request->generated.end());
+    ov::Tensor input_ids(ov::element::i64, ov::Shape{1, ids.size()});
+    std::copy(ids.begin(), ids.end(), input_ids.data<int64_t>());
+
+    ov::genai::GenerationConfig config = request->config;
+    size_t generated = request->generated.size();
+    if (config.max_new_tokens != SIZE_MAX)
+        config.max_new_tokens -= std::min(config.max_new_tokens, generated);
+    config.min_new_tokens -= std::min(config.min_new_tokens, generated);
+    request->object = pipeline.add_request(request->request_id, input_ids, config);
+    running.push_back(request);
+
+    // a recompute is charged again, the pipeline runs its prompt again
+    genai_tenant& tenant = tenants[request->tenant];
+    --tenant.queued;
+    ++tenant.running;
+    charge(*request, ids.size());
+    if (!request->released_once) {
+        request->released_once = true;
+        update_average(tenant.avg_queue_ms, elapsed_ms(request->enqueued));
+    }
+}
+
+bool genai_request_scheduler::preempt_for(const genai_scheduled_request& head) {
+    // the request of lowest order among those of lower priority than the head
+    std::shared_ptr<genai_scheduled_request> victim;
+    for (const auto& request : running) {
+        if (request->priority >= head.priority || (victim && runs_before(*request, *victim)))
+            continue;
+        std::lock_guard<std::mutex> lock(request->mutex);
+        if (request->preemptible && request->object)
+            victim = request;
+    }
+    if (!victim)
+        return false;
+    {
+        std::lock_guard<std::mutex> lock(victim->mutex);
+        victim->object->drop();
+        victim->object.reset();
+        ++victim->preemptions;
+    }
+    running.erase(std::find(running.begin(), running.end(), victim));
+    queued.push_back(victim);
+    genai_tenant& tenant = tenants[victim->tenant];
+    --tenant.running;
+    ++tenant.queued;
+    return true;
+}
+
+void genai_request_scheduler::schedule(ov::genai::ContinuousBatchingPipeline& pipeline) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = queued.begin(); it != queued.end();) {
+        if ((*it)->dropped) {
+            --tenants[(*it)->tenant].queued;
+            it = queued.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    for (auto it = running.begin(); it != running.end();) {
+        genai_scheduled_request& request = **it;
+        bool ended;
+        {
+            std::lock_guard<std::mutex> request_lock(request.mutex);
+            charge(request, request.tokens_read - request.tokens_charged);
+            request.tokens_charged = request.tokens_read;
+            ended = request.object->get_status() != ov::genai::GenerationStatus::RUNNING;
+        }
+        if (ended) {
+            finish(request);
+            it = running.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    if (queued.empty())
+        return;
+
+    // the cache usage is the one of the last step, which an idle pipeline no longer updates: with nothing
+    // running the cache is free. The requests released now only show in the next step, each one is counted
+    // as the average share of the requests of the last step, or as the rest of the limit when it had none.
+    float cache_usage = 0.0f;
+    float request_usage = 0.0f;
+    bool idle = !pipeline.has_non_finished_requests();
+    if (config.max_cache_usage > 0.0f && !idle) {
+        ov::genai::PipelineMetrics metrics = pipeline.get_metrics();
+        cache_usage = metrics.cache_usage;
+        request_usage = metrics.requests ? metrics.cache_usage / metrics.requests : config.max_cache_usage;
+    }
+    bool preempted = false;
+    while (!queued.empty()) {
+        size_t next = next_queued();
+        // a copy, preempting appends to the queue
+        std::shared_ptr<genai_scheduled_request> head = queued[next];
+        bool room = (!config.max_running_requests || running.size() < config.max_running_requests)
+            && (config.max_cache_usage <= 0.0f || cache_usage < config.max_cache_usage);
+        // the head of an idle pipeline always goes, or a limit below the usage of one request stalls the queue
+        if (!room && !(idle && running.empty())) {
+            if (!config.preemption || preempted || !preempt_for(*head))
+                break;
+            preempted = true;
+        }
+        release(pipeline, head);
+        queued.erase(queued.begin() + next);
+        cache_usage += idle ? config.max_cache_usage : request_usage;
+    }
+}
@@ -0,0 +1,138 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "genai_common.h"
+#include "ov_genai_continuous_batching_pipeline.h"
+
+/**
+ * @struct genai_scheduled_request
+ * @brief A request added with options, held by the wrapper until its scheduler releases it into the pipeline.
+ * A preempted request is dropped from the pipeline and queued again, to be recomputed from its prompt and
+ * the tokens its caller has already read.
+ */
+struct genai_scheduled_request {
+    uint64_t request_id = 0;
+    int32_t priority = 0;
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+    std::string tenant;
+    uint64_t arrival = 0;
+    std::chrono::steady_clock::time_point enqueued;
+    bool released_once = false;
+    size_t tokens_charged = 0;  //!< The tokens read already charged to the tenant.
+    std::vector<int64_t> input_ids;
+    ov::genai::GenerationConfig config;
+
+    std::mutex mutex;  //!< Guards the members below against the step.
+    std::shared_ptr<ov::genai::GenerationHandleImpl> object;  //!< Null while queued.
+    std::vector<int64_t> generated;  //!< The tokens read by the caller so far.
+    size_t tokens_read = 0;  //!< Of all sequences, kept also when the request is not preemptible.
+    bool preemptible = true;  //!< Cleared when the tokens read cannot be tracked.
+    size_t preemptions = 0;
+    std::atomic<bool> dropped{false};
+
+    /**
+     * @brief The handle for a read whose tokens cannot be recorded, which makes the request non-preemptible.
+     */
+    std::shared_ptr<ov::genai::GenerationHandleImpl> untracked();
+
+    /**
+     * @brief The status of the request, RUNNING while it is queued.
+     */
+    ov::genai::GenerationStatus status();
+
+    /**
+     * @brief Drops the request, from the queue or from the pipeline.
+     */
+    void drop();
+
+    /**
+     * @brief Counts the tokens of outputs read by the caller and keeps them for a recompute, call it with mutex held.
+     */
+    void record(const ov::genai::GenerationOutputs& outputs);
+};
+
+/**
+ * @struct genai_tenant
+ * @brief The share of one tenant of a request scheduler.
+ */
+struct genai_tenant {
+    float weight = 1.0f;
+    double virtual_time = 0.0;  //!< The tokens served divided by the weight, the least served goes first.
+    size_t queued = 0;
+    size_t running = 0;
+    uint64_t requests_served = 0;
+    uint64_t tokens_served = 0;
+    double avg_queue_ms = 0.0;
+    double avg_latency_ms = 0.0;
+};
+
+/**
+ * @struct genai_request_scheduler
+ * @brief Orders the requests added with options into the steps of a continuous batching pipeline.
+ * Before each step the queued requests are released by priority, then by the virtual time of their tenant,
+ * then by deadline, then by arrival, as long as the limits leave room. When they do not, a request of lower
+ * priority may be preempted for the head of the queue, at most one per step.
+ *
+ * The virtual time of a tenant grows with the prompt tokens it has released and the generated tokens its
+ * callers have read, divided by its weight, so that competing tenants are served tokens by their weights.
+ * A tenant coming back from idle starts at the least virtual time of the busy ones, it gets no credit for
+ * the time it sent nothing.
+ */
+struct genai_request_scheduler {
+    explicit genai_request_scheduler(const ov_genai_request_scheduler_config_t& config) : config(config) {}
+
+    /**
+     * @brief Replaces the limits, the requests already released keep running.
+     */
+    void set_config(const ov_genai_request_scheduler_config_t& config);
+
+    /**
+     * @brief Queues a request until a step releases it.
+     */
+    void enqueue(const std::shared_ptr<genai_scheduled_request>& request);
+
+    /**
+     * @brief Sets the weight of a tenant, greater than 0.
+     */
+    void set_weight(const std::string& tenant, float weight);
+
+    /**
+     * @brief The share of a tenant, a default one for a tenant without requests.
+     */
+    genai_tenant get_tenant(const std::string& tenant);
+
+    /**
+     * @brief Whether requests are waiting in the queue.
+     */
+    bool has_queued();
+
+    /**
+     * @brief Releases the queued requests which fit, called right before each step.
+     */
+    void schedule(ov::genai::ContinuousBatchingPipeline& pipeline);
+
+private:
+    static bool runs_before(const genai_scheduled_request& a, const genai_scheduled_request& b);
+    size_t next_queued();
+    void charge(genai_scheduled_request& request, size_t tokens);
+    void finish(genai_scheduled_request& request);
+    void release(ov::genai::ContinuousBatchingPipeline& pipeline, const std::shared_ptr<genai_scheduled_request>& request);
+    bool preempt_for(const genai_scheduled_request& head);
+
+    std::mutex mutex;
+    ov_genai_request_scheduler_config_t config;
+    std::vector<std::shared_ptr<genai_scheduled_request>> queued;
+    std::vector<std::shared_ptr<genai_scheduled_request>> running;
+    std::map<std::string, genai_tenant> tenants;
+    uint64_t next_arrival = 0;
+};
@@ -0,0 +1,36 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "genai_speculative.h"
+
+#include <algorithm>
+
+void genai_speculative_counters::record(const ov::genai::PerfMetrics& perf_metrics,
+    const ov::genai::GenerationConfig& config) {
+    uint64_t tokens = perf_metrics.num_generated_tokens;
+    uint64_t steps = perf_metrics.raw_metrics.m_new_token_times.size();
+    if (tokens == 0 || steps == 0)
+        return;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ++metrics.generations;
+    metrics.steps += steps;
+    metrics.generated_tokens += tokens;
+    if (tokens > steps)
+        metrics.draft_tokens_accepted += tokens - steps;
+    // the first step is the prefill, tokens are proposed from the second one on; with
+    // assistant_confidence_threshold the number of proposals is not known and only the accepted ones are counted
+    if (config.num_assistant_tokens > 0)
+        metrics.draft_tokens_proposed += (steps - 1) * config.num_assistant_tokens;
+}
+
+ov_genai_speculative_metrics_t genai_speculative_counters::get() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    ov_genai_speculative_metrics_t result = metrics;
+    result.acceptance_rate = result.draft_tokens_proposed == 0 ? 0.0f
+        : static_cast<float>(std::min(result.draft_tokens_accepted, result.draft_tokens_proposed))
+            / static_cast<float>(result.draft_tokens_proposed);
+    result.tokens_per_step = result.steps == 0 ? 0.0f
+        : static_cast<float>(result.generated_tokens) / static_cast<float>(result.steps);
+    return result;
+}
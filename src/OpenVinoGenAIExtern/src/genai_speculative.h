@@ -0,0 +1,32 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <cstdint>
+#include <mutex>
+
+#include "genai_common.h"
+
+/**
+ * @struct genai_speculative_counters
+ * @brief Acceptance counters of a pipeline decoding speculatively, read from the PerfMetrics of its generations.
+ * Every step of the main model validates the proposed tokens, of the draft model or found in the prompt, and adds
+ * one of its own, so the tokens generated beyond one per step are the accepted proposals.
+ */
+struct genai_speculative_counters {
+    /**
+     * @brief Adds one generation. A generation without new tokens, a replay of the completion cache, is skipped.
+     * @param perf_metrics The metrics of the generation.
+     * @param config The config it ran with, num_assistant_tokens gives the tokens proposed per step.
+     */
+    void record(const ov::genai::PerfMetrics& perf_metrics, const ov::genai::GenerationConfig& config);
+
+    /**
+     * @brief The counters with the rates computed from them.
+     */
+    ov_genai_speculative_metrics_t get() const;
+
+private:
+    mutable std::mutex mutex;
+    ov_genai_speculative_metrics_t metrics{};
+};
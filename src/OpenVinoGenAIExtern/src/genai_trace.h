@@ -0,0 +1,85 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+#include "genai_common.h"
+#include "ov_genai_trace.h"
+
+/**
+ * @brief Global switch of the tracer, checked before any span is recorded.
+ */
+extern std::atomic<bool> genai_trace_enabled_flag;
+
+/**
+ * @brief Checks whether tracing is enabled, a single relaxed load.
+ */
+inline bool genai_trace_enabled() {
+    return genai_trace_enabled_flag.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Current steady clock time in nanoseconds, same clock as RawPerfMetrics.
+ */
+int64_t genai_trace_now();
+
+/**
+ * @brief Records one span into the ring, does nothing when tracing is disabled.
+ * @param kind The kind of span.
+ * @param request_id The track the span belongs to.
+ * @param begin_ns The begin of the span in steady clock nanoseconds.
+ * @param end_ns The end of the span in steady clock nanoseconds.
+ */
+void genai_trace_record(ov_genai_trace_span_e kind, uint64_t request_id, int64_t begin_ns, int64_t end_ns);
+
+/**
+ * @struct genai_trace_request
+ * @brief Traces one generate call of a pipeline.
+ * Captures the begin time on construction, wraps the streamer callback and
+ * expands the PerfMetrics of the results into spans on finish.
+ */
+struct genai_trace_request {
+    uint64_t id = 0;
+    int64_t begin_ns = 0;
+
+    genai_trace_request();
+
+    bool active() const {
+        return id != 0;
+    }
+
+    /**
+     * @brief Wraps a streamer callback so every call is recorded as a span.
+     */
+    ov::genai::StreamerVariant streamer(ov_genai_streamer_callback_t* callback) const;
+
+    /**
+     * @brief Wraps a streamer structure so every call is recorded as a span.
+     */
+    ov::genai::StreamerVariant streamer(const ov_genai_streamer_t* streamer) const;
+
+    /**
+     * @brief Records the generate span, the spans of perf_metrics are added when they are present.
+     */
+    void finish(const ov::genai::PerfMetrics* perf_metrics = nullptr) const;
+};
+
+/**
+ * @struct genai_trace_scope
+ * @brief Records a span covering the lifetime of the object.
+ */
+struct genai_trace_scope {
+    ov_genai_trace_span_e kind;
+    uint64_t request_id;
+    int64_t begin_ns;
+
+    genai_trace_scope(ov_genai_trace_span_e kind, uint64_t request_id = 0)
+        : kind(kind), request_id(request_id), begin_ns(genai_trace_enabled() ? genai_trace_now() : 0) {}
+
+    ~genai_trace_scope() {
+        if (begin_ns != 0)
+            genai_trace_record(kind, request_id, begin_ns, genai_trace_now());
+    }
+};
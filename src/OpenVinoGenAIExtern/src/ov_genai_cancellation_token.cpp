@@ -0,0 +1,61 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file ov_genai_cancellation_token.cpp
+* @brief This is a source file for the ov_genai_cancellation_token C API, a flag which stops the
+* generations it is attached to between two decode steps.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/24
+*/
+
+#include "ov_genai_cancellation_token.h"
+
+#include <memory>
+
+#include "genai_common.h"
+
+ov_status_e ov_genai_cancellation_token_create(ov_genai_cancellation_token_t** cancellation_token) {
+    if (!cancellation_token) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        std::unique_ptr<ov_genai_cancellation_token_t> _cancellation_token(new ov_genai_cancellation_token_t);
+        _cancellation_token->object = std::make_shared<std::atomic<bool>>(false);
+        *cancellation_token = _cancellation_token.release();
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+void ov_genai_cancellation_token_free(ov_genai_cancellation_token_t* cancellation_token) {
+    if (cancellation_token)
+        delete cancellation_token;
+}
+
+ov_status_e ov_genai_cancellation_token_cancel(ov_genai_cancellation_token_t* cancellation_token) {
+    if (!cancellation_token) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    cancellation_token->object->store(true, std::memory_order_relaxed);
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_cancellation_token_reset(ov_genai_cancellation_token_t* cancellation_token) {
+    if (!cancellation_token) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    cancellation_token->object->store(false, std::memory_order_relaxed);
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_cancellation_token_is_cancelled(const ov_genai_cancellation_token_t* cancellation_token,
+    bool* cancelled) {
+    if (!cancellation_token || !cancelled) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    *cancelled = cancellation_token->object->load(std::memory_order_relaxed);
+    return ov_status_e::OK;
+}
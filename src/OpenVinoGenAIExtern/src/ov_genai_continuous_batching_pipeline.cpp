@@ -12,11 +12,171 @@
 */
 
 #include "ov_genai_continuous_batching_pipeline.h"
+#include <algorithm>
+#include <limits>
 #include <memory>
 
+#include "genai_admission.h"
+#include "genai_chat_session.h"
+#include "genai_coalescing.h"
 #include "genai_common.h"
+#include "genai_completion_cache.h"
+#include "genai_prefix_snapshot.h"
+#include "genai_scheduler.h"
+#include "genai_trace.h"
 #include <cstdarg>
 
+// the prompt length the admission control counts for a request
+static size_t prompt_tokens(ov::genai::ContinuousBatchingPipeline& pipeline, const std::string& prompt) {
+    return pipeline.get_tokenizer().encode(prompt).input_ids.get_shape().back();
+}
+
+static size_t prompt_tokens(ov::genai::ContinuousBatchingPipeline&, const ov::Tensor& input_ids) {
+    return input_ids.get_shape().back();
+}
+
+// The KV cache usage of the last step, which an idle pipeline no longer updates: with no request left the
+// cache is free, whatever the last step used.
+static float cache_usage(ov::genai::ContinuousBatchingPipeline& pipeline) {
+    return pipeline.has_non_finished_requests() ? pipeline.get_metrics().cache_usage : 0.0f;
+}
+
+// Adds a request through the admission control of the pipeline, if it has one. A rejected request gets an
+// empty handle, and the message in rejection unless that is null.
+template <typename Input>
+static ov::genai::GenerationHandle admit_request(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    uint64_t request_id,
+    const Input& input,
+    const ov::genai::GenerationConfig& sampling_params,
+    std::string* rejection) {
+    ov::genai::ContinuousBatchingPipeline& pipeline = *continuous_batching_pipeline->object;
+    std::shared_ptr<genai_admission> admission = std::atomic_load(&continuous_batching_pipeline->admission);
+    if (!admission)
+        return pipeline.add_request(request_id, input, sampling_params);
+
+    size_t tokens = admission->counts_prompt_tokens() ? prompt_tokens(pipeline, input) : 0;
+    std::lock_guard<std::mutex> lock(admission->mutex);
+    if (const char* limit = admission->check(cache_usage(pipeline), tokens)) {
+        if (rejection)
+            *rejection = admission->rejection(limit);
+        return nullptr;
+    }
+    ov::genai::GenerationHandle handle = pipeline.add_request(request_id, input, sampling_params);
+    admission->enqueue(handle, tokens);
+    return handle;
+}
+
+// the entries of the pipeline in a completion cache keep tokens, apart from the text the LLMPipeline keeps
+static std::string completion_key(const std::string& key) {
+    return "tokens\x1d" + key;
+}
+
+// Serves the handle without a new request in the pipeline: from the completion cache, or by subscribing it
+// to an identical greedy request in flight. The key is left for lead_request, empty when the request is
+// neither to be shared nor kept.
+static bool join_request(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const std::string& prompt,
+    const ov::genai::GenerationConfig& sampling_params,
+    ov_genai_generation_handle_t& generation_handle,
+    std::string& key) {
+    std::shared_ptr<genai_completion_cache> cache = std::atomic_load(&continuous_batching_pipeline->completion_cache);
+    std::shared_ptr<genai_coalescer> coalescer = std::atomic_load(&continuous_batching_pipeline->coalescer);
+    if (!cache && !coalescer)
+        return false;
+    key = genai_request_key(prompt, sampling_params);
+    if (key.empty())
+        return false;
+    if (cache) {
+        if (std::shared_ptr<const genai_completion> completion = cache->get(completion_key(key))) {
+            auto replay = std::make_shared<genai_coalesced_request>(nullptr);
+            replay->generated_ids = completion->generated_ids;
+            replay->generated_log_probs = completion->generated_log_probs;
+            replay->score = completion->score;
+            replay->finish_reason = static_cast<ov::genai::GenerationFinishReason>(completion->finish_reason);
+            generation_handle.coalesced = genai_subscribe(std::move(replay));
+            return true;
+        }
+    }
+    if (coalescer)
+        generation_handle.coalesced = coalescer->join(key);
+    return generation_handle.coalesced != nullptr;
+}
+
+// Sets the request just added on the handle. With a key, the request is the one identical requests join,
+// and its outputs are kept in the completion cache once it finishes.
+static void lead_request(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const std::string& key,
+    ov::genai::GenerationHandle object,
+    ov_genai_generation_handle_t& generation_handle) {
+    std::shared_ptr<genai_completion_cache> cache = std::atomic_load(&continuous_batching_pipeline->completion_cache);
+    std::shared_ptr<genai_coalescer> coalescer = std::atomic_load(&continuous_batching_pipeline->coalescer);
+    if (key.empty() || (!cache && !coalescer)) {
+        generation_handle.object = std::move(object);
+        return;
+    }
+    auto request = std::make_shared<genai_coalesced_request>(std::move(object));
+    if (cache) {
+        request->on_finished = [cache, key = completion_key(key)](const genai_coalesced_request& finished) {
+            genai_completion completion;
+            completion.generated_ids = finished.generated_ids;
+            completion.generated_log_probs = finished.generated_log_probs;
+            completion.score = finished.score;
+            completion.finish_reason = static_cast<int32_t>(finished.finish_reason);
+            cache->put(key, std::move(completion));
+        };
+    }
+    generation_handle.coalesced = coalescer ? coalescer->lead(key, std::move(request)) : genai_subscribe(std::move(request));
+}
+
+// the request scheduler of the pipeline, created on first use
+static std::shared_ptr<genai_request_scheduler> request_scheduler(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline) {
+    std::shared_ptr<genai_request_scheduler> scheduler = std::atomic_load(&continuous_batching_pipeline->scheduler);
+    if (!scheduler) {
+        auto created = std::make_shared<genai_request_scheduler>(ov_genai_request_scheduler_config_t{});
+        if (std::atomic_compare_exchange_strong(&continuous_batching_pipeline->scheduler, &scheduler, created))
+            scheduler = created;
+    }
+    return scheduler;
+}
+
+// the chat sessions of the pipeline, created on first use
+static std::shared_ptr<genai_chat_sessions> chat_sessions(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline) {
+    std::shared_ptr<genai_chat_sessions> sessions = std::atomic_load(&continuous_batching_pipeline->sessions);
+    if (!sessions) {
+        auto created = std::make_shared<genai_chat_sessions>(ov_genai_chat_sessions_config_t{});
+        if (std::atomic_compare_exchange_strong(&continuous_batching_pipeline->sessions, &sessions, created))
+            sessions = created;
+    }
+    return sessions;
+}
+
+// releases the scheduled requests which fit into the coming step
+static void schedule_requests(ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline) {
+    if (std::shared_ptr<genai_request_scheduler> scheduler = std::atomic_load(&continuous_batching_pipeline->scheduler))
+        scheduler->schedule(*continuous_batching_pipeline->object);
+}
+
+static bool has_scheduled_requests(ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline) {
+    std::shared_ptr<genai_request_scheduler> scheduler = std::atomic_load(&continuous_batching_pipeline->scheduler);
+    return scheduler && scheduler->has_queued();
+}
+
+static void step_pipeline(ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline) {
+    genai_trace_scope trace(TRACE_PIPELINE_STEP);
+    continuous_batching_pipeline->added_since_step = 0;
+    auto begin = std::chrono::steady_clock::now();
+    continuous_batching_pipeline->object->step();
+    if (std::shared_ptr<genai_admission> admission = std::atomic_load(&continuous_batching_pipeline->admission)) {
+        admission->after_step(
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count());
+    }
+}
+
 
 ov_status_e
 ov_genai_continuous_batching_pipeline_create_with_scheduler(
@@ -39,6 +199,13 @@ ov_genai_continuous_batching_pipeline_create_with_scheduler(
         return ov_status_e::OK;
 }
 
+void
+ov_genai_continuous_batching_pipeline_free(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline) {
+    if (continuous_batching_pipeline)
+        delete continuous_batching_pipeline;
+}
+
 ov_status_e
 ov_genai_continuous_batching_pipeline_create_with_scheduler_device(
     ov_genai_continuous_batching_pipeline_t** continuous_batching_pipeline,
@@ -77,25 +244,15 @@ ov_genai_continuous_batching_pipeline_create_with_scheduler_device_plugin(
 
     try {
 
-        ov::AnyMap llm_plugin_config_args = {};
-        ov::AnyMap tokenizer_plugin_config_args = {};
-        size_t property_size = llm_plugin_config_args_size / 2;
+        std::exception_ptr error;
         va_list args_ptr;
         va_start(args_ptr, tokenizer_plugin_config_args_size);
-        for (size_t i = 0; i < property_size; i++) {
-            std::string property_key = va_arg(args_ptr, char*); 
-                std::string _value = va_arg(args_ptr, char*);      
-                ov::Any value = _value;                            
-                llm_plugin_config_args[property_key] = value;
-        }
-        property_size = tokenizer_plugin_config_args_size / 2;
-        for (size_t i = 0; i < property_size; i++) {
-            std::string property_key = va_arg(args_ptr, char*);
-            std::string _value = va_arg(args_ptr, char*);
-            ov::Any value = _value;
-            tokenizer_plugin_config_args[property_key] = value;
-        }
+        ov::AnyMap llm_plugin_config_args = properties_from_args_list(args_ptr, llm_plugin_config_args_size / 2, error);
+        ov::AnyMap tokenizer_plugin_config_args = properties_from_args_list(args_ptr,
+            tokenizer_plugin_config_args_size / 2, error);
         va_end(args_ptr);
+        if (error)
+            std::rethrow_exception(error);
 
 
         std::unique_ptr<ov_genai_continuous_batching_pipeline_t>
@@ -175,18 +332,13 @@ ov_genai_continuous_batching_pipeline_create_with_scheduler_tokenizer_device_plu
 
     try {
 
-        ov::AnyMap plugin_config_args = {};
-
-        size_t property_size = plugin_config_args_size / 2;
+        std::exception_ptr error;
         va_list args_ptr;
         va_start(args_ptr, plugin_config_args_size);
-        for (size_t i = 0; i < property_size; i++) {
-            std::string property_key = va_arg(args_ptr, char*);
-            std::string _value = va_arg(args_ptr, char*);
-            ov::Any value = _value;
-            plugin_config_args[property_key] = value;
-        }
+        ov::AnyMap plugin_config_args = properties_from_args_list(args_ptr, plugin_config_args_size / 2, error);
         va_end(args_ptr);
+        if (error)
+            std::rethrow_exception(error);
 
 
 
@@ -201,6 +353,59 @@ ov_genai_continuous_batching_pipeline_create_with_scheduler_tokenizer_device_plu
         return ov_status_e::OK;
 }
 
+ov_status_e
+ov_genai_continuous_batching_pipeline_create_with_draft_model(
+    ov_genai_continuous_batching_pipeline_t** continuous_batching_pipeline,
+    const char* model_path,
+    ov_genai_scheduler_config_t* scheduler_config,
+    const char* device_name,
+    const char* draft_model_path,
+    const char* draft_device_name) {
+
+    if (!continuous_batching_pipeline || !model_path || !scheduler_config || !device_name
+        || !draft_model_path || !draft_device_name) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        ov::AnyMap properties = { ov::genai::draft_model(draft_model_path, draft_device_name) };
+
+        std::unique_ptr<ov_genai_continuous_batching_pipeline_t>
+            _continuous_batching_pipeline(new ov_genai_continuous_batching_pipeline_t);
+        _continuous_batching_pipeline->object
+            = std::make_shared<ov::genai::ContinuousBatchingPipeline>(model_path, *scheduler_config,
+                device_name, properties);
+        *continuous_batching_pipeline = _continuous_batching_pipeline.release();
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e
+ov_genai_continuous_batching_pipeline_create_with_prompt_lookup(
+    ov_genai_continuous_batching_pipeline_t** continuous_batching_pipeline,
+    const char* model_path,
+    ov_genai_scheduler_config_t* scheduler_config,
+    const char* device_name) {
+
+    if (!continuous_batching_pipeline || !model_path || !scheduler_config || !device_name) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        ov::AnyMap properties = { ov::genai::prompt_lookup(true) };
+
+        std::unique_ptr<ov_genai_continuous_batching_pipeline_t>
+            _continuous_batching_pipeline(new ov_genai_continuous_batching_pipeline_t);
+        _continuous_batching_pipeline->object
+            = std::make_shared<ov::genai::ContinuousBatchingPipeline>(model_path, *scheduler_config,
+                device_name, properties);
+        *continuous_batching_pipeline = _continuous_batching_pipeline.release();
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
 
 ov_status_e
 ov_genai_continuous_batching_pipeline_get_tokenizer(
@@ -266,6 +471,287 @@ ov_genai_continuous_batching_pipeline_get_metrics(
 }
 
 
+ov_status_e
+ov_genai_continuous_batching_pipeline_set_admission_config(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const ov_genai_admission_config_t* admission_config) {
+
+    if (!continuous_batching_pipeline) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        // the requests queued under the old limits are not counted by the new ones
+        std::shared_ptr<genai_admission> admission;
+        if (admission_config)
+            admission = std::make_shared<genai_admission>(*admission_config);
+        std::atomic_store(&continuous_batching_pipeline->admission, admission);
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e
+ov_genai_continuous_batching_pipeline_get_admission_state(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    ov_genai_admission_state_t* admission_state) {
+
+    if (!continuous_batching_pipeline || !admission_state) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        float usage = cache_usage(*continuous_batching_pipeline->object);
+        std::shared_ptr<genai_admission> admission = std::atomic_load(&continuous_batching_pipeline->admission);
+        if (admission) {
+            admission->get_state(admission_state, usage);
+        }
+        else {
+            *admission_state = {};
+            admission_state->cache_usage = usage;
+        }
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e
+ov_genai_continuous_batching_pipeline_set_request_coalescing(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    int enable) {
+
+    if (!continuous_batching_pipeline) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        // the requests already shared keep their coalescer
+        std::atomic_store(&continuous_batching_pipeline->coalescer,
+            enable ? std::make_shared<genai_coalescer>() : std::shared_ptr<genai_coalescer>());
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e
+ov_genai_continuous_batching_pipeline_get_coalesced_requests(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    uint64_t* coalesced_requests) {
+
+    if (!continuous_batching_pipeline || !coalesced_requests) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        std::shared_ptr<genai_coalescer> coalescer = std::atomic_load(&continuous_batching_pipeline->coalescer);
+        *coalesced_requests = coalescer ? coalescer->joined_requests() : 0;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e
+ov_genai_continuous_batching_pipeline_set_completion_cache(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const ov_genai_completion_cache_config_t* cache_config) {
+
+    if (!continuous_batching_pipeline || (cache_config && cache_config->disk_path && !cache_config->model_id)) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        // the current cache lets go of its file first, a new cache of the same file could not lock it
+        std::atomic_store(&continuous_batching_pipeline->completion_cache, std::shared_ptr<genai_completion_cache>());
+        std::shared_ptr<genai_completion_cache> cache;
+        if (cache_config)
+            cache = std::make_shared<genai_completion_cache>(*cache_config);
+        std::atomic_store(&continuous_batching_pipeline->completion_cache, cache);
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e
+ov_genai_continuous_batching_pipeline_get_completion_cache_stats(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    ov_genai_completion_cache_stats_t* cache_stats) {
+
+    if (!continuous_batching_pipeline || !cache_stats) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        *cache_stats = ov_genai_completion_cache_stats_t{};
+        if (std::shared_ptr<genai_completion_cache> cache = std::atomic_load(&continuous_batching_pipeline->completion_cache))
+            cache->get_stats(cache_stats);
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e
+ov_genai_continuous_batching_pipeline_save_prefix_snapshot(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const char* path,
+    const char* model_id,
+    const char* prefix) {
+
+    if (!continuous_batching_pipeline || !path || !model_id || !prefix) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        ov::Tensor input_ids = continuous_batching_pipeline->object->get_tokenizer().encode(prefix).input_ids;
+        genai_prefix_snapshot snapshot;
+        snapshot.model_id = model_id;
+        snapshot.input_ids.assign(input_ids.data<int64_t>(), input_ids.data<int64_t>() + input_ids.get_size());
+        snapshot.hash = genai_token_hash(snapshot.input_ids);
+        genai_save_prefix_snapshot(path, snapshot);
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e
+ov_genai_continuous_batching_pipeline_restore_prefix_snapshots(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const char* path,
+    const char* model_id,
+    size_t* restored) {
+
+    if (!continuous_batching_pipeline || !path || !model_id || !restored) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        ov::genai::ContinuousBatchingPipeline& pipeline = *continuous_batching_pipeline->object;
+        // the prefills step the pipeline here, which must not run beside the step of the caller's requests
+        if (pipeline.has_non_finished_requests() || continuous_batching_pipeline->added_since_step.load())
+            OPENVINO_THROW("Restore the prefix snapshots before adding requests");
+        std::vector<genai_prefix_snapshot> snapshots = genai_read_prefix_snapshots(path, model_id);
+        ov::genai::GenerationConfig config;
+        config.max_new_tokens = 1;
+        config.ignore_eos = true;
+        // the prefills take ids from the top down, out of the way of the ones callers count up from 1
+        uint64_t request_id = std::numeric_limits<uint64_t>::max();
+        std::vector<ov::genai::GenerationHandle> prefills;
+        for (const genai_prefix_snapshot& snapshot : snapshots) {
+            if (snapshot.input_ids.empty())
+                continue;
+            ov::Tensor input_ids(ov::element::i64, ov::Shape{1, snapshot.input_ids.size()});
+            std::copy(snapshot.input_ids.begin(), snapshot.input_ids.end(), input_ids.data<int64_t>());
+            prefills.push_back(pipeline.add_request(request_id--, input_ids, config));
+        }
+        auto running = [](const ov::genai::GenerationHandle& prefill) {
+            return prefill->get_status() == ov::genai::GenerationStatus::RUNNING;
+        };
+        while (std::any_of(prefills.begin(), prefills.end(), running))
+            step_pipeline(continuous_batching_pipeline);
+        *restored = prefills.size();
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e
+ov_genai_continuous_batching_pipeline_set_request_scheduler_config(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const ov_genai_request_scheduler_config_t* scheduler_config) {
+
+    if (!continuous_batching_pipeline || !scheduler_config) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        request_scheduler(continuous_batching_pipeline)->set_config(*scheduler_config);
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e
+ov_genai_continuous_batching_pipeline_set_tenant_weight(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const char* tenant,
+    float weight) {
+
+    if (!continuous_batching_pipeline || !(weight > 0.0f)) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        request_scheduler(continuous_batching_pipeline)->set_weight(tenant ? tenant : "", weight);
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e
+ov_genai_continuous_batching_pipeline_get_tenant_metrics(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const char* tenant,
+    ov_genai_tenant_metrics_t* tenant_metrics) {
+
+    if (!continuous_batching_pipeline || !tenant_metrics) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        genai_tenant state = request_scheduler(continuous_batching_pipeline)->get_tenant(tenant ? tenant : "");
+        tenant_metrics->queued_requests = state.queued;
+        tenant_metrics->running_requests = state.running;
+        tenant_metrics->requests_served = state.requests_served;
+        tenant_metrics->tokens_served = state.tokens_served;
+        tenant_metrics->avg_queue_ms = static_cast<float>(state.avg_queue_ms);
+        tenant_metrics->avg_latency_ms = static_cast<float>(state.avg_latency_ms);
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e
+ov_genai_continuous_batching_pipeline_add_request_with_options(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    uint64_t request_id,
+    const char* prompt,
+    const ov_genai_generation_config_t* sampling_params,
+    const ov_genai_streamer_t* streamer,
+    const ov_genai_request_options_t* options,
+    ov_genai_generation_handle_t** generation_handle) {
+
+    if (!continuous_batching_pipeline || !prompt || !sampling_params || (streamer && !streamer->callback)
+        || !generation_handle) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        ov::genai::Tokenizer tokenizer = continuous_batching_pipeline->object->get_tokenizer();
+        // tokenized here, a preempted request is recomputed from its tokens
+        ov::Tensor input_ids = tokenizer.encode(prompt).input_ids;
+        auto request = std::make_shared<genai_scheduled_request>();
+        request->request_id = request_id;
+        request->input_ids.assign(input_ids.data<int64_t>(), input_ids.data<int64_t>() + input_ids.get_size());
+        request->config = *sampling_params->object;
+        request->preemptible = request->config.num_return_sequences == 1 && request->config.num_beams == 1;
+        if (options) {
+            request->priority = options->priority;
+            if (options->deadline_ms)
+                request->deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(options->deadline_ms);
+            if (options->tenant)
+                request->tenant = options->tenant;
+        }
+
+        std::unique_ptr<ov_genai_generation_handle_t> _generation_handle(new ov_genai_generation_handle_t);
+        if (streamer)
+            _generation_handle->stream = std::make_shared<genai_text_stream>(*streamer, tokenizer);
+        _generation_handle->scheduled = request;
+        request_scheduler(continuous_batching_pipeline)->enqueue(request);
+        *generation_handle = _generation_handle.release();
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
 ov_status_e
 ov_genai_continuous_batching_pipeline_get_metrics_add_request_with_input_ids(
     ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
@@ -279,8 +765,13 @@ ov_genai_continuous_batching_pipeline_get_metrics_add_request_with_input_ids(
     }
 
     try {
-        ov::genai::GenerationHandle object;
-        object = continuous_batching_pipeline->object->add_request(request_id, *input_ids->object, *sampling_params->object);
+        std::string rejection;
+        ov::genai::GenerationHandle object = admit_request(continuous_batching_pipeline, request_id,
+            *input_ids->object, *sampling_params->object, &rejection);
+        if (!object) {
+            set_last_err(ov_status_e::REQUEST_BUSY, rejection.c_str());
+            return ov_status_e::REQUEST_BUSY;
+        }
 
         std::unique_ptr<ov_genai_generation_handle_t> _generation_handle(new ov_genai_generation_handle_t);
         _generation_handle->object = std::move(object);
@@ -303,10 +794,18 @@ ov_genai_continuous_batching_pipeline_get_metrics_add_request_with_prompt(
     }
 
     try {
-        ov::genai::GenerationHandle object;
-        object = continuous_batching_pipeline->object->add_request(request_id, prompt, *sampling_params->object);
         std::unique_ptr<ov_genai_generation_handle_t> _generation_handle(new ov_genai_generation_handle_t);
-        _generation_handle->object = std::move(object);
+        std::string key;
+        if (!join_request(continuous_batching_pipeline, prompt, *sampling_params->object, *_generation_handle, key)) {
+            std::string rejection;
+            ov::genai::GenerationHandle object = admit_request(continuous_batching_pipeline, request_id,
+                std::string(prompt), *sampling_params->object, &rejection);
+            if (!object) {
+                set_last_err(ov_status_e::REQUEST_BUSY, rejection.c_str());
+                return ov_status_e::REQUEST_BUSY;
+            }
+            lead_request(continuous_batching_pipeline, key, std::move(object), *_generation_handle);
+        }
         *generation_handle = _generation_handle.release();
     
     }
@@ -314,6 +813,211 @@ ov_genai_continuous_batching_pipeline_get_metrics_add_request_with_prompt(
         return ov_status_e::OK;
 }
 
+ov_status_e
+ov_genai_continuous_batching_pipeline_add_request_with_prompt_and_streamer(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    uint64_t request_id,
+    const char* prompt,
+    const ov_genai_generation_config_t* sampling_params,
+    const ov_genai_streamer_t* streamer,
+    ov_genai_generation_handle_t** generation_handle) {
+
+    if (!continuous_batching_pipeline || !prompt || !sampling_params || !streamer || !streamer->callback
+        || !generation_handle) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        std::unique_ptr<ov_genai_generation_handle_t> _generation_handle(new ov_genai_generation_handle_t);
+        _generation_handle->stream = std::make_shared<genai_text_stream>(*streamer,
+            continuous_batching_pipeline->object->get_tokenizer());
+        std::string key;
+        if (!join_request(continuous_batching_pipeline, prompt, *sampling_params->object, *_generation_handle, key)) {
+            std::string rejection;
+            ov::genai::GenerationHandle object = admit_request(continuous_batching_pipeline, request_id,
+                std::string(prompt), *sampling_params->object, &rejection);
+            if (!object) {
+                set_last_err(ov_status_e::REQUEST_BUSY, rejection.c_str());
+                return ov_status_e::REQUEST_BUSY;
+            }
+            lead_request(continuous_batching_pipeline, key, std::move(object), *_generation_handle);
+        }
+        *generation_handle = _generation_handle.release();
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_try_add_request(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    uint64_t request_id,
+    const char* prompt,
+    const ov_genai_generation_config_t* sampling_params,
+    const ov_genai_streamer_t* streamer,
+    size_t max_requests,
+    ov_genai_generation_handle_t** generation_handle,
+    ov_genai_try_status_e* result) {
+
+    if (!continuous_batching_pipeline || !prompt || !sampling_params || (streamer && !streamer->callback)
+        || !generation_handle || !result) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        std::unique_ptr<ov_genai_generation_handle_t> _generation_handle(new ov_genai_generation_handle_t);
+        if (streamer) {
+            _generation_handle->stream = std::make_shared<genai_text_stream>(*streamer,
+                continuous_batching_pipeline->object->get_tokenizer());
+        }
+        // a request replayed from the cache, or joining one in flight, takes no room
+        std::string key;
+        if (join_request(continuous_batching_pipeline, prompt, *sampling_params->object, *_generation_handle, key)) {
+            *generation_handle = _generation_handle.release();
+            *result = TRY_OK;
+            return ov_status_e::OK;
+        }
+        std::atomic<size_t>& added = continuous_batching_pipeline->added_since_step;
+        if (max_requests
+            && continuous_batching_pipeline->object->get_metrics().requests + added.load() >= max_requests) {
+            *result = TRY_QUEUE_FULL;
+            return ov_status_e::OK;
+        }
+        ov::genai::GenerationHandle object;
+        try {
+            object = admit_request(continuous_batching_pipeline, request_id, std::string(prompt),
+                *sampling_params->object, nullptr);
+        }
+        catch (const ov::Busy&) {
+            // a pipeline refusing the request is the queue being full, not an error
+        }
+        if (!object) {
+            *result = TRY_QUEUE_FULL;
+            return ov_status_e::OK;
+        }
+        lead_request(continuous_batching_pipeline, key, std::move(object), *_generation_handle);
+        ++added;
+        *generation_handle = _generation_handle.release();
+        *result = TRY_OK;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e
+ov_genai_continuous_batching_pipeline_try_add_session_request(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    uint64_t request_id,
+    const char* session_id,
+    const char* prompt,
+    const ov_genai_generation_config_t* sampling_params,
+    const ov_genai_streamer_t* streamer,
+    size_t max_requests,
+    ov_genai_generation_handle_t** generation_handle,
+    ov_genai_try_status_e* result) {
+
+    if (!continuous_batching_pipeline || !session_id || !prompt || !sampling_params || (streamer && !streamer->callback)
+        || !generation_handle || !result) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        std::shared_ptr<genai_chat_sessions> sessions = chat_sessions(continuous_batching_pipeline);
+        std::shared_ptr<genai_chat_session> session = sessions->open(session_id);
+        ov::genai::Tokenizer tokenizer = continuous_batching_pipeline->object->get_tokenizer();
+        std::unique_ptr<ov_genai_generation_handle_t> _generation_handle(new ov_genai_generation_handle_t);
+        if (streamer)
+            _generation_handle->stream = std::make_shared<genai_text_stream>(*streamer, tokenizer);
+        std::atomic<size_t>& added = continuous_batching_pipeline->added_since_step;
+        if (max_requests
+            && continuous_batching_pipeline->object->get_metrics().requests + added.load() >= max_requests) {
+            *result = TRY_QUEUE_FULL;
+            return ov_status_e::OK;
+        }
+        bool re_prefill = !session->snapshot().empty();
+        ov::genai::GenerationHandle object;
+        try {
+            object = admit_request(continuous_batching_pipeline, request_id,
+                session->templated_prompt(tokenizer, prompt), *sampling_params->object, nullptr);
+        }
+        catch (const ov::Busy&) {
+            // a pipeline refusing the request is the queue being full, not an error
+        }
+        if (!object) {
+            *result = TRY_QUEUE_FULL;
+            return ov_status_e::OK;
+        }
+        ++added;
+        sessions->count_turn(re_prefill);
+
+        // the answer joins the history once the caller has read all of it
+        auto request = std::make_shared<genai_coalesced_request>(std::move(object));
+        request->on_finished = [session, tokenizer, message = std::string(prompt)](
+            const genai_coalesced_request& finished) mutable {
+            session->add_turn(message, tokenizer.decode(finished.generated_ids));
+        };
+        _generation_handle->coalesced = genai_subscribe(std::move(request));
+        *generation_handle = _generation_handle.release();
+        *result = TRY_OK;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e
+ov_genai_continuous_batching_pipeline_set_chat_sessions(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const ov_genai_chat_sessions_config_t* sessions_config) {
+
+    if (!continuous_batching_pipeline) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        std::shared_ptr<genai_chat_sessions> sessions;
+        if (sessions_config)
+            sessions = std::make_shared<genai_chat_sessions>(*sessions_config);
+        std::atomic_store(&continuous_batching_pipeline->sessions, sessions);
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e
+ov_genai_continuous_batching_pipeline_end_session(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    const char* session_id) {
+
+    if (!continuous_batching_pipeline || !session_id) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        if (std::shared_ptr<genai_chat_sessions> sessions = std::atomic_load(&continuous_batching_pipeline->sessions))
+            sessions->end(session_id);
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e
+ov_genai_continuous_batching_pipeline_get_chat_sessions_stats(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    ov_genai_chat_sessions_stats_t* sessions_stats) {
+
+    if (!continuous_batching_pipeline || !sessions_stats) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        *sessions_stats = ov_genai_chat_sessions_stats_t{};
+        if (std::shared_ptr<genai_chat_sessions> sessions = std::atomic_load(&continuous_batching_pipeline->sessions))
+            sessions->get_stats(sessions_stats, 0);
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
 OPENVINO_C_API(ov_status_e)
 ov_genai_continuous_batching_pipeline_step(
     ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline) {
@@ -322,7 +1026,29 @@ ov_genai_continuous_batching_pipeline_step(
     }
 
     try {
-        continuous_batching_pipeline->object->step();
+        schedule_requests(continuous_batching_pipeline);
+        step_pipeline(continuous_batching_pipeline);
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+OPENVINO_C_API(ov_status_e)
+ov_genai_continuous_batching_pipeline_try_step(
+    ov_genai_continuous_batching_pipeline_t* continuous_batching_pipeline,
+    ov_genai_try_status_e* result) {
+    if (!continuous_batching_pipeline || !result) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        schedule_requests(continuous_batching_pipeline);
+        if (!continuous_batching_pipeline->object->has_non_finished_requests()) {
+            *result = TRY_IDLE;
+            return ov_status_e::OK;
+        }
+        step_pipeline(continuous_batching_pipeline);
+        *result = TRY_OK;
     }
     CATCH_OV_GENAI_EXCEPTIONS
         return ov_status_e::OK;
@@ -338,7 +1064,8 @@ ov_genai_continuous_batching_pipeline_has_non_finished_requests(
     }
 
     try {
-        *flag = static_cast<int>(continuous_batching_pipeline->object->has_non_finished_requests());
+        *flag = static_cast<int>(continuous_batching_pipeline->object->has_non_finished_requests()
+            || has_scheduled_requests(continuous_batching_pipeline));
     }
     CATCH_OV_GENAI_EXCEPTIONS
         return ov_status_e::OK;
@@ -367,7 +1094,9 @@ ov_genai_continuous_batching_pipeline_generate_with_input_ids(
         for (int i = 0; i < input_ids_size; ++i) {
             v_sampling_params.push_back(*sampling_params[i].object);
         }
+        genai_trace_request trace;
         auto v_encoded_generation_results = continuous_batching_pipeline->object->generate(v_input_ids, v_sampling_params);
+        trace.finish();
 
         *encoded_generation_results_size = v_encoded_generation_results.size();
         encoded_generation_results =
@@ -408,7 +1137,9 @@ ov_genai_continuous_batching_pipeline_generate_with_input_ids_and_streamer(
         for (int i = 0; i < input_ids_size; ++i) {
             v_sampling_params.push_back(*sampling_params[i].object);
         }
-        auto v_encoded_generation_results = continuous_batching_pipeline->object->generate(v_input_ids, v_sampling_params,*callback);
+        genai_trace_request trace;
+        auto v_encoded_generation_results = continuous_batching_pipeline->object->generate(v_input_ids, v_sampling_params, trace.streamer(callback));
+        trace.finish();
 
         *encoded_generation_results_size = v_encoded_generation_results.size();
         encoded_generation_results =
@@ -446,7 +1177,9 @@ ov_genai_continuous_batching_pipeline_generate_with_prompts(
         for (int i = 0; i < sampling_params_size; ++i) {
             v_sampling_params.push_back(*sampling_params[i].object);
         }
+        genai_trace_request trace;
         auto v_generation_results = continuous_batching_pipeline->object->generate(prompts, v_sampling_params);
+        trace.finish();
 
         *generation_results_size = v_generation_results.size();
         generation_results =
@@ -484,7 +1217,9 @@ ov_genai_continuous_batching_pipeline_generate_with_prompts_and_streamer(
         for (int i = 0; i < sampling_params_size; ++i) {
             v_sampling_params.push_back(*sampling_params[i].object);
         }
-        auto v_generation_results = continuous_batching_pipeline->object->generate(prompts, v_sampling_params, *callback);
+        genai_trace_request trace;
+        auto v_generation_results = continuous_batching_pipeline->object->generate(prompts, v_sampling_params, trace.streamer(callback));
+        trace.finish();
 
         *generation_results_size = v_generation_results.size();
         generation_results =
@@ -46,4 +46,20 @@ ov_status_e ov_genai_decoded_results_get_texts(ov_genai_decoded_results_t* decod
     }
     CATCH_OV_GENAI_EXCEPTIONS
         return ov_status_e::OK;
-}
\ No newline at end of file
+}
+
+ov_status_e ov_genai_decoded_results_get_perf_metrics(ov_genai_decoded_results_t* decoded_results,
+	ov_genai_perf_metrics_t** perf_metrics) {
+    if (!decoded_results || !perf_metrics) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        std::unique_ptr<ov_genai_perf_metrics_t> _perf_metrics(new ov_genai_perf_metrics_t);
+        _perf_metrics->object = std::shared_ptr<ov::genai::PerfMetrics>(
+            decoded_results->object, &decoded_results->object->perf_metrics);
+        *perf_metrics = _perf_metrics.release();
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
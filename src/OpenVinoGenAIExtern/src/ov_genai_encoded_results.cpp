@@ -33,4 +33,20 @@ ov_status_e ov_genai_encoded_results_create(ov_genai_encoded_results_t** encoded
 void ov_genai_encoded_results_free(ov_genai_encoded_results_t* encoded_results) {
     if (encoded_results)
         delete encoded_results;
-}
\ No newline at end of file
+}
+
+ov_status_e ov_genai_encoded_results_get_perf_metrics(ov_genai_encoded_results_t* encoded_results,
+	ov_genai_perf_metrics_t** perf_metrics) {
+    if (!encoded_results || !perf_metrics) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        std::unique_ptr<ov_genai_perf_metrics_t> _perf_metrics(new ov_genai_perf_metrics_t);
+        _perf_metrics->object = std::shared_ptr<ov::genai::PerfMetrics>(
+            encoded_results->object, &encoded_results->object->perf_metrics);
+        *perf_metrics = _perf_metrics.release();
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
@@ -11,7 +11,9 @@
 */
 
 #include "ov_genai_generation_config.h"
+#include <algorithm>
 #include <memory>
+#include <set>
 
 #include "genai_common.h"
 #include <cstdarg>
@@ -22,6 +24,23 @@ ov::AnyMap generation_config_param_to_anymap(const generation_config_param_t par
     config_map["max_new_tokens"] = param.max_new_tokens;
     config_map["max_length"] = param.max_length;
     config_map["ignore_eos"] = param.ignore_eos;
+    if (param.min_new_tokens > 0) {
+        config_map["min_new_tokens"] = param.min_new_tokens;
+    }
+    if (param.stop_strings) {
+        config_map["stop_strings"] = std::set<std::string>(param.stop_strings,
+            param.stop_strings + param.stop_strings_size);
+    }
+    if (param.include_stop_str_in_output) {
+        config_map["include_stop_str_in_output"] = param.include_stop_str_in_output;
+    }
+    if (param.stop_token_ids) {
+        config_map["stop_token_ids"] = std::set<int64_t>(param.stop_token_ids,
+            param.stop_token_ids + param.stop_token_ids_size);
+    }
+    if (param.logprobs > 0) {
+        config_map["logprobs"] = param.logprobs;
+    }
 
 
     config_map["num_beam_groups"] = param.num_beam_groups;
@@ -30,7 +49,8 @@ ov::AnyMap generation_config_param_to_anymap(const generation_config_param_t par
     config_map["length_penalty"] = param.length_penalty;
     config_map["num_return_sequences"] = param.num_return_sequences;
     config_map["no_repeat_ngram_size"] = param.no_repeat_ngram_size;
-    config_map["stop_criteria"] = param.stop_criteria;
+    // the parameter copies the values of ov::genai::StopCriteria, the config only reads the library type
+    config_map["stop_criteria"] = static_cast<ov::genai::StopCriteria>(param.stop_criteria);
 
 
 
@@ -39,6 +59,24 @@ ov::AnyMap generation_config_param_to_anymap(const generation_config_param_t par
     config_map["top_k"] = param.top_k;
     config_map["do_sample"] = param.do_sample;
     config_map["repetition_penalty"] = param.repetition_penalty;
+    if (param.presence_penalty != 0.0f) {
+        config_map["presence_penalty"] = param.presence_penalty;
+    }
+    if (param.frequency_penalty != 0.0f) {
+        config_map["frequency_penalty"] = param.frequency_penalty;
+    }
+    if (param.rng_seed != 0) {
+        config_map["rng_seed"] = param.rng_seed;
+    }
+    if (param.num_assistant_tokens > 0) {
+        config_map["num_assistant_tokens"] = param.num_assistant_tokens;
+    }
+    if (param.assistant_confidence_threshold > 0.0f) {
+        config_map["assistant_confidence_threshold"] = param.assistant_confidence_threshold;
+    }
+    if (param.max_ngram_size > 0) {
+        config_map["max_ngram_size"] = param.max_ngram_size;
+    }
 
 
 
@@ -116,10 +154,20 @@ bool ov_genai_generation_config_is_multinomial(
 }
 
 
+bool generation_config_param_is_valid(const generation_config_param_t& param) {
+    if (param.stop_strings) {
+        for (size_t i = 0; i < param.stop_strings_size; ++i) {
+            if (!param.stop_strings[i])
+                return false;
+        }
+    }
+    return true;
+}
+
 ov_status_e ov_genai_generation_config_update_generation_config(
     const ov_genai_generation_config_t* generation_config, 
     const generation_config_param_t* config_param) {
-    if (!generation_config || !config_param) {
+    if (!generation_config || !config_param || !generation_config_param_is_valid(*config_param)) {
         return ov_status_e::INVALID_C_PARAM;
     }
 
@@ -221,6 +269,147 @@ ov_status_e ov_genai_generation_config_set_ignore_eos(const ov_genai_generation_
         return ov_status_e::OK;
 }
 
+ov_status_e ov_genai_generation_config_get_min_new_tokens(const ov_genai_generation_config_t* generation_config,
+    size_t* min_new_tokens) {
+    if (!generation_config || !min_new_tokens) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        *min_new_tokens = generation_config->object->min_new_tokens;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_set_min_new_tokens(const ov_genai_generation_config_t* generation_config,
+    size_t min_new_tokens) {
+    if (!generation_config) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        generation_config->object->min_new_tokens = min_new_tokens;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_get_stop_strings(const ov_genai_generation_config_t* generation_config,
+    char** stop_strings,
+    size_t* size) {
+    if (!generation_config || !stop_strings || !size) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        std::string block;
+        for (const std::string& stop : generation_config->object->stop_strings) {
+            block += stop;
+            block += '\0';
+        }
+        std::unique_ptr<char[]> _stop_strings(new char[block.size() + 1]);
+        std::copy_n(block.c_str(), block.size() + 1, _stop_strings.get());
+        *size = block.size();
+        *stop_strings = _stop_strings.release();
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_set_stop_strings(const ov_genai_generation_config_t* generation_config,
+    const char* const* stop_strings,
+    size_t size) {
+    if (!generation_config || (!stop_strings && size > 0)) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        std::set<std::string> strings;
+        for (size_t i = 0; i < size; ++i) {
+            if (!stop_strings[i])
+                return ov_status_e::INVALID_C_PARAM;
+            strings.insert(stop_strings[i]);
+        }
+        generation_config->object->stop_strings = std::move(strings);
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_get_include_stop_str_in_output(const ov_genai_generation_config_t* generation_config,
+    bool* include_stop_str_in_output) {
+    if (!generation_config || !include_stop_str_in_output) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        *include_stop_str_in_output = generation_config->object->include_stop_str_in_output;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_set_include_stop_str_in_output(const ov_genai_generation_config_t* generation_config,
+    bool include_stop_str_in_output) {
+    if (!generation_config) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        generation_config->object->include_stop_str_in_output = include_stop_str_in_output;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_get_stop_token_ids(const ov_genai_generation_config_t* generation_config,
+    int64_t* stop_token_ids,
+    size_t capacity,
+    size_t* size) {
+    if (!generation_config || !size || (!stop_token_ids && capacity > 0)) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        const std::set<int64_t>& tokens = generation_config->object->stop_token_ids;
+        *size = tokens.size();
+        std::copy_n(tokens.begin(), std::min(capacity, tokens.size()), stop_token_ids);
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_set_stop_token_ids(const ov_genai_generation_config_t* generation_config,
+    const int64_t* stop_token_ids,
+    size_t size) {
+    if (!generation_config || (!stop_token_ids && size > 0)) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        generation_config->object->stop_token_ids = std::set<int64_t>(stop_token_ids, stop_token_ids + size);
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_get_logprobs(const ov_genai_generation_config_t* generation_config,
+    size_t* logprobs) {
+    if (!generation_config || !logprobs) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        *logprobs = generation_config->object->logprobs;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_set_logprobs(const ov_genai_generation_config_t* generation_config,
+    size_t logprobs) {
+    if (!generation_config) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        generation_config->object->logprobs = logprobs;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
 // Beam search specific
 
 ov_status_e ov_genai_generation_config_get_num_beam_groups(const ov_genai_generation_config_t* generation_config,
@@ -533,6 +722,150 @@ ov_status_e ov_genai_generation_config_set_repetition_penalty(const ov_genai_gen
         return ov_status_e::OK;
 }
 
+ov_status_e ov_genai_generation_config_get_presence_penalty(const ov_genai_generation_config_t* generation_config,
+    float* presence_penalty) {
+    if (!generation_config || !presence_penalty) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        *presence_penalty = generation_config->object->presence_penalty;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_set_presence_penalty(const ov_genai_generation_config_t* generation_config,
+    float presence_penalty) {
+    if (!generation_config) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        generation_config->object->presence_penalty = presence_penalty;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_get_frequency_penalty(const ov_genai_generation_config_t* generation_config,
+    float* frequency_penalty) {
+    if (!generation_config || !frequency_penalty) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        *frequency_penalty = generation_config->object->frequency_penalty;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_set_frequency_penalty(const ov_genai_generation_config_t* generation_config,
+    float frequency_penalty) {
+    if (!generation_config) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        generation_config->object->frequency_penalty = frequency_penalty;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_get_rng_seed(const ov_genai_generation_config_t* generation_config,
+    size_t* rng_seed) {
+    if (!generation_config || !rng_seed) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        *rng_seed = generation_config->object->rng_seed;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_set_rng_seed(const ov_genai_generation_config_t* generation_config,
+    size_t rng_seed) {
+    if (!generation_config) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        generation_config->object->rng_seed = rng_seed;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_get_num_assistant_tokens(const ov_genai_generation_config_t* generation_config,
+    size_t* num_assistant_tokens) {
+    if (!generation_config || !num_assistant_tokens) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        *num_assistant_tokens = generation_config->object->num_assistant_tokens;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_set_num_assistant_tokens(const ov_genai_generation_config_t* generation_config,
+    size_t num_assistant_tokens) {
+    if (!generation_config) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        generation_config->object->num_assistant_tokens = num_assistant_tokens;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_get_assistant_confidence_threshold(const ov_genai_generation_config_t* generation_config,
+    float* assistant_confidence_threshold) {
+    if (!generation_config || !assistant_confidence_threshold) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        *assistant_confidence_threshold = generation_config->object->assistant_confidence_threshold;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_set_assistant_confidence_threshold(const ov_genai_generation_config_t* generation_config,
+    float assistant_confidence_threshold) {
+    if (!generation_config) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        generation_config->object->assistant_confidence_threshold = assistant_confidence_threshold;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_get_max_ngram_size(const ov_genai_generation_config_t* generation_config,
+    size_t* max_ngram_size) {
+    if (!generation_config || !max_ngram_size) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        *max_ngram_size = generation_config->object->max_ngram_size;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_config_set_max_ngram_size(const ov_genai_generation_config_t* generation_config,
+    size_t max_ngram_size) {
+    if (!generation_config) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        generation_config->object->max_ngram_size = max_ngram_size;
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
 
 // EOS special token
 
@@ -16,7 +16,61 @@
 #include "ov_genai_generation_handle.h"
 
 
+#include "genai_coalescing.h"
 #include "genai_common.h"
+#include "genai_scheduler.h"
+
+namespace {
+// The GenerationHandle of a handle, with the scheduled request locked against preemption while its
+// outputs are read and recorded. The object is null while the request waits in the queue.
+struct tracked_object {
+	std::unique_lock<std::mutex> lock;
+	std::shared_ptr<ov::genai::GenerationHandleImpl> object;
+	genai_scheduled_request* scheduled = nullptr;
+
+	explicit tracked_object(ov_genai_generation_handle_t* generation_handle)
+		: object(generation_handle->object), scheduled(generation_handle->scheduled.get()) {
+		if (scheduled) {
+			lock = std::unique_lock<std::mutex>(scheduled->mutex);
+			object = scheduled->object;
+		}
+	}
+
+	bool dropped() const {
+		return scheduled && scheduled->dropped;
+	}
+
+	void record(const ov::genai::GenerationOutputs& outputs) {
+		if (scheduled)
+			scheduled->record(outputs);
+	}
+
+	// Lets the scheduler preempt the request again, the recorded outputs are the caller's.
+	void unlock() {
+		if (lock.owns_lock())
+			lock.unlock();
+	}
+};
+
+// The GenerationHandle for the blocking reads, null while a scheduled request is queued.
+std::shared_ptr<ov::genai::GenerationHandleImpl> untracked_object(ov_genai_generation_handle_t* generation_handle) {
+	return generation_handle->scheduled ? generation_handle->scheduled->untracked() : generation_handle->object;
+}
+
+// Counts the tokens of a blocking read into the share of the tenant of a scheduled request.
+void count_read(ov_genai_generation_handle_t* generation_handle, const ov::genai::GenerationOutputs& outputs) {
+	if (generation_handle->scheduled) {
+		std::lock_guard<std::mutex> lock(generation_handle->scheduled->mutex);
+		generation_handle->scheduled->record(outputs);
+	}
+}
+
+ov_genai_generation_outputs_t* new_generation_outputs(ov::genai::GenerationOutputs outputs) {
+	std::unique_ptr<ov_genai_generation_outputs_t> _generation_outputs(new ov_genai_generation_outputs_t);
+	_generation_outputs->object = std::make_shared<ov::genai::GenerationOutputs>(std::move(outputs));
+	return _generation_outputs.release();
+}
+}  // namespace
 
 void
 ov_genai_generation_handle_free(
@@ -34,7 +88,9 @@ ov_genai_generation_handle_get_status(
 		return ov_status_e::INVALID_C_PARAM;
 	}
 	try {
-		auto tmp = generation_handle->object->get_status();
+		auto tmp = generation_handle->coalesced ? generation_handle->coalesced->status()
+			: generation_handle->scheduled ? generation_handle->scheduled->status()
+			: generation_handle->object->get_status();
 		*status = static_cast<int>(tmp);
 	}
 	CATCH_OV_GENAI_EXCEPTIONS
@@ -50,8 +106,12 @@ ov_genai_generation_handle_can_read(
 		return ov_status_e::INVALID_C_PARAM;
 	}
 	try {
-		auto tmp = generation_handle->object->can_read();
-		*can_read = static_cast<int>(tmp);
+		if (generation_handle->coalesced) {
+			*can_read = static_cast<int>(generation_handle->coalesced->can_read());
+			return ov_status_e::OK;
+		}
+		tracked_object tracked(generation_handle);
+		*can_read = static_cast<int>(tracked.object && tracked.object->can_read());
 	}
 	CATCH_OV_GENAI_EXCEPTIONS
 		return ov_status_e::OK;
@@ -65,7 +125,12 @@ ov_genai_generation_handle_drop(
 		return ov_status_e::INVALID_C_PARAM;
 	}
 	try {
-		generation_handle->object->drop();
+		if (generation_handle->coalesced)
+			generation_handle->coalesced->drop();
+		else if (generation_handle->scheduled)
+			generation_handle->scheduled->drop();
+		else
+			generation_handle->object->drop();
 	}
 	CATCH_OV_GENAI_EXCEPTIONS
 		return ov_status_e::OK;
@@ -80,8 +145,15 @@ ov_genai_generation_handle_back(
 		return ov_status_e::INVALID_C_PARAM;
 	}
 	try {
-		auto tmp = generation_handle->object->back();
-		
+		if (generation_handle->coalesced) {
+			*generation_outputs = new_generation_outputs(generation_handle->coalesced->back());
+			return ov_status_e::OK;
+		}
+		std::shared_ptr<ov::genai::GenerationHandleImpl> object = untracked_object(generation_handle);
+		if (!object)
+			return ov_status_e::RESULT_NOT_READY;
+		auto tmp = object->back();
+
 		std::unique_ptr<ov_genai_generation_outputs_t> _generation_outputs(new ov_genai_generation_outputs_t);
 		_generation_outputs->object = std::make_shared<ov::genai::GenerationOutputs>(std::move(tmp));
 		*generation_outputs = _generation_outputs.release();
@@ -99,7 +171,15 @@ ov_genai_generation_handle_read(
 		return ov_status_e::INVALID_C_PARAM;
 	}
 	try {
-		auto tmp = generation_handle->object->read();
+		if (generation_handle->coalesced) {
+			*generation_outputs = new_generation_outputs(generation_handle->coalesced->read(true));
+			return ov_status_e::OK;
+		}
+		std::shared_ptr<ov::genai::GenerationHandleImpl> object = untracked_object(generation_handle);
+		if (!object)
+			return ov_status_e::RESULT_NOT_READY;
+		auto tmp = object->read();
+		count_read(generation_handle, tmp);
 
 		std::unique_ptr<ov_genai_generation_outputs_t> _generation_outputs(new ov_genai_generation_outputs_t);
 		_generation_outputs->object = std::make_shared<ov::genai::GenerationOutputs>(std::move(tmp));
@@ -109,6 +189,62 @@ ov_genai_generation_handle_read(
 		return ov_status_e::OK;
 }
 
+ov_status_e
+ov_genai_generation_handle_try_read(
+	ov_genai_generation_handle_t* generation_handle,
+	ov_genai_generation_outputs_t** generation_outputs,
+	ov_genai_try_status_e* result) {
+
+	if (!generation_handle || !generation_outputs || !result) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+	try {
+		if (generation_handle->coalesced) {
+			genai_subscription& subscription = *generation_handle->coalesced;
+			ov::genai::GenerationStatus status = subscription.status();
+			ov::genai::GenerationOutputs tmp = subscription.read(false);
+			if (!tmp.empty()) {
+				*generation_outputs = new_generation_outputs(std::move(tmp));
+				*result = TRY_OK;
+			}
+			else if (status == ov::genai::GenerationStatus::RUNNING) {
+				*result = TRY_NO_DATA;
+			}
+			else {
+				*result = status == ov::genai::GenerationStatus::FINISHED ? TRY_FINISHED : TRY_DROPPED;
+			}
+			return ov_status_e::OK;
+		}
+		tracked_object tracked(generation_handle);
+		if (!tracked.object) {
+			*result = tracked.dropped() ? TRY_DROPPED : TRY_NO_DATA;
+			return ov_status_e::OK;
+		}
+		// the status is taken first, a request over before can_read has no more outputs to come
+		ov::genai::GenerationStatus status = tracked.object->get_status();
+		if (tracked.object->can_read()) {
+			auto tmp = tracked.object->read();
+			tracked.record(tmp);
+			std::unique_ptr<ov_genai_generation_outputs_t> _generation_outputs(new ov_genai_generation_outputs_t);
+			_generation_outputs->object = std::make_shared<ov::genai::GenerationOutputs>(std::move(tmp));
+			*generation_outputs = _generation_outputs.release();
+			*result = TRY_OK;
+		}
+		else if (status == ov::genai::GenerationStatus::RUNNING) {
+			*result = TRY_NO_DATA;
+		}
+		else if (status == ov::genai::GenerationStatus::DROPPED_BY_PIPELINE
+			|| status == ov::genai::GenerationStatus::DROPPED_BY_HANDLE) {
+			*result = TRY_DROPPED;
+		}
+		else {
+			*result = TRY_FINISHED;
+		}
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
+
 ov_status_e
 ov_genai_generation_handle_read_all(
 	ov_genai_generation_handle_t* generation_handle,
@@ -119,7 +255,16 @@ ov_genai_generation_handle_read_all(
 		return ov_status_e::INVALID_C_PARAM;
 	}
 	try {
-		auto tmp = generation_handle->object->read_all();
+		std::vector<ov::genai::GenerationOutput> tmp;
+		if (generation_handle->coalesced) {
+			tmp = generation_handle->coalesced->read_all();
+		}
+		else {
+			std::shared_ptr<ov::genai::GenerationHandleImpl> object = untracked_object(generation_handle);
+			if (!object)
+				return ov_status_e::RESULT_NOT_READY;
+			tmp = object->read_all();
+		}
 		*size = tmp.size();
 		generation_output =
 			(ov_genai_generation_output_t**)malloc(tmp.size() * sizeof(ov_genai_generation_output_t*));
@@ -132,4 +277,84 @@ ov_genai_generation_handle_read_all(
 	}
 	CATCH_OV_GENAI_EXCEPTIONS
 		return ov_status_e::OK;
-}
\ No newline at end of file
+}
+
+ov_status_e
+ov_genai_generation_handle_stream(
+	ov_genai_generation_handle_t* generation_handle,
+	int* finished) {
+
+	if (!generation_handle || !generation_handle->stream || !finished) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+	try {
+		genai_text_stream& stream = *generation_handle->stream;
+		if (generation_handle->coalesced) {
+			// every handle of the request streams the tokens to its own streamer
+			genai_subscription& subscription = *generation_handle->coalesced;
+			ov::genai::GenerationOutputs outputs = subscription.read(false);
+			bool stop = false;
+			if (!outputs.empty()) {
+				for (int64_t token : outputs.begin()->second.generated_ids) {
+					if (stream.put(token)) {
+						stop = true;
+						break;
+					}
+				}
+			}
+			if (stop)
+				subscription.drop();
+			*finished = 0;
+			if (subscription.finished()) {
+				if (!stop)
+					stream.end();
+				*finished = 1;
+			}
+			return ov_status_e::OK;
+		}
+		tracked_object tracked(generation_handle);
+		if (!tracked.object) {
+			// queued by the scheduler, or dropped from its queue
+			*finished = tracked.dropped() ? 1 : 0;
+			return ov_status_e::OK;
+		}
+		// read blocks until an output arrives, so only what is already there is taken
+		std::vector<int64_t> tokens;
+		while (tracked.object->can_read()) {
+			ov::genai::GenerationOutputs outputs = tracked.object->read();
+			if (outputs.empty())
+				continue;
+			tracked.record(outputs);
+			// the text of the first sequence, as the streamers of the pipelines do
+			const std::vector<int64_t>& ids = outputs.begin()->second.generated_ids;
+			tokens.insert(tokens.end(), ids.begin(), ids.end());
+		}
+		// the callback runs unlocked, it may drop its own handle and does not hold up the scheduler
+		tracked.unlock();
+		bool stop = false;
+		for (int64_t token : tokens) {
+			if (stream.put(token)) {
+				stop = true;
+				break;
+			}
+		}
+		if (stop) {
+			if (generation_handle->scheduled)
+				generation_handle->scheduled->drop();
+			else
+				tracked.object->drop();
+		}
+		*finished = 0;
+		tracked_object current(generation_handle);
+		bool done = current.object ? current.object->get_status() != ov::genai::GenerationStatus::RUNNING
+				&& !current.object->can_read()
+			: current.dropped();
+		if (stop || done) {
+			if (!stop)
+				stream.end();
+			*finished = 1;
+		}
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
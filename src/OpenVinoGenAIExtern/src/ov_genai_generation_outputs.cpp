@@ -43,6 +43,25 @@ ov_genai_generation_output_get_generated_ids(
 		return ov_status_e::OK;
 }
 
+ov_status_e
+ov_genai_generation_output_copy_generated_ids(
+	ov_genai_generation_output_t* generation_output,
+	int64_t* generated_ids,
+	size_t capacity,
+	size_t* size) {
+
+	if (!generation_output || !size || (!generated_ids && capacity > 0)) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+	try {
+		const std::vector<int64_t>& ids = generation_output->object->generated_ids;
+		*size = ids.size();
+		std::copy_n(ids.begin(), std::min(capacity, ids.size()), generated_ids);
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
+
 OPENVINO_C_API(ov_status_e)
 ov_genai_generation_output_get_score(
 	ov_genai_generation_output_t* generation_output,
@@ -115,4 +134,37 @@ ov_genai_generation_outputs_at(
 	}
 	CATCH_OV_GENAI_EXCEPTIONS
 		return ov_status_e::OK;
-}
\ No newline at end of file
+}
+
+ov_status_e
+ov_genai_generation_outputs_get_size(
+	ov_genai_generation_outputs_t* generation_outputs,
+	size_t* size) {
+	if (!generation_outputs || !size) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+	try {
+		*size = generation_outputs->object->size();
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
+
+ov_status_e
+ov_genai_generation_outputs_get_keys(
+	ov_genai_generation_outputs_t* generation_outputs,
+	uint64_t* keys,
+	size_t* size) {
+	if (!generation_outputs || !keys || !size) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+	try {
+		size_t index = 0;
+		for (const auto& output : *generation_outputs->object) {
+			keys[index++] = output.first;
+		}
+		*size = index;
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
@@ -15,10 +15,156 @@
 #include <cstdarg>
 #include <memory>
 
+#include "genai_chat_session.h"
+#include "genai_coalescing.h"
 #include "genai_common.h"
+#include "genai_completion_cache.h"
+#include "genai_speculative.h"
+#include "genai_trace.h"
 
 
 
+/**
+ * @brief Adds the cancellation token of the pipeline to a generate call.
+ * A cancelled token fails the call before it starts. A running call is stopped between decode steps
+ * through the streamer, which the pipeline only accepts for one input and one sequence, greedy or multinomial;
+ * other calls run to their end.
+ */
+static ov::genai::StreamerVariant cancellable(const ov_genai_llm_pipeline_t* llm_pipeline,
+	ov::genai::StreamerVariant streamer,
+	const ov::genai::OptionalGenerationConfig& config,
+	size_t batch_size) {
+	std::shared_ptr<std::atomic<bool>> cancelled = llm_pipeline->cancelled;
+	if (!cancelled)
+		return streamer;
+	if (cancelled->load(std::memory_order_relaxed))
+		ov::Cancelled::create("The generation was cancelled before it started");
+	// the streaming precondition of the pipeline, a call it does not hold for cannot take a streamer
+	const ov::genai::GenerationConfig& effective = config ? *config : llm_pipeline->object->get_generation_config();
+	bool streamable = effective.num_return_sequences == 1
+		&& (effective.is_greedy_decoding() || effective.is_multinomial());
+	if (batch_size != 1 || !streamable)
+		return streamer;
+
+	if (auto function = std::get_if<std::function<bool(std::string)>>(&streamer)) {
+		return std::function<bool(std::string)>([cancelled, callback = *function](std::string word) {
+			return cancelled->load(std::memory_order_relaxed) || callback(std::move(word));
+		});
+	}
+	std::shared_ptr<ov::genai::StreamerBase> inner;
+	if (auto base = std::get_if<std::shared_ptr<ov::genai::StreamerBase>>(&streamer))
+		inner = *base;
+	return std::make_shared<genai_cancellable_streamer>(cancelled, inner);
+}
+
+/**
+ * @brief Adds a generation to the acceptance counters of a pipeline created with a draft model.
+ */
+static void count_speculative(const ov_genai_llm_pipeline_t* llm_pipeline,
+	const ov::genai::OptionalGenerationConfig& config,
+	const ov::genai::PerfMetrics& perf_metrics) {
+	if (llm_pipeline->speculative)
+		llm_pipeline->speculative->record(perf_metrics, config ? *config : llm_pipeline->object->get_generation_config());
+}
+
+static size_t batch_size(const ov::Tensor& input_ids) {
+	ov::Shape shape = input_ids.get_shape();
+	return shape.empty() ? 1 : shape[0];
+}
+
+/**
+ * @brief The config the AnyMap overloads of generate build: the pipeline config updated with the parameters.
+ */
+static ov::genai::GenerationConfig config_from_param(const ov_genai_llm_pipeline_t* llm_pipeline,
+	const generation_config_param_t& config_param) {
+	ov::genai::GenerationConfig config = llm_pipeline->object->get_generation_config();
+	config.update_generation_config(generation_config_param_to_anymap(config_param));
+	return config;
+}
+
+/**
+ * @brief Generates for one prompt. In a chat the turn is added to the session, an imported session passing its
+ * whole history in the prompt. Outside of a chat a greedy request goes through the completion cache of the
+ * pipeline: a hit passes the whole text to the streamer at once, and only a generation which ran to its end,
+ * neither stopped by its streamer nor cancelled, is kept.
+ */
+static ov::genai::DecodedResults generate_prompt(ov_genai_llm_pipeline_t* llm_pipeline,
+	const std::string& prompt,
+	const ov::genai::OptionalGenerationConfig& config,
+	ov::genai::StreamerVariant streamer) {
+	ov::genai::StreamerVariant stream = cancellable(llm_pipeline, std::move(streamer), config, 1);
+	if (std::shared_ptr<genai_chat_session> chat = llm_pipeline->chat) {
+		ov::genai::DecodedResults results = chat->native
+			? llm_pipeline->object->generate(prompt, config, stream)
+			: llm_pipeline->object->generate(chat->templated_prompt(llm_pipeline->object->get_tokenizer(), prompt),
+				config, stream);
+		if (!results.texts.empty())
+			chat->add_turn(prompt, results.texts[0]);
+		return results;
+	}
+
+	std::shared_ptr<genai_completion_cache> cache = std::atomic_load(&llm_pipeline->completion_cache);
+	std::string key;
+	if (cache)
+		key = genai_request_key(prompt, config ? *config : llm_pipeline->object->get_generation_config());
+	if (key.empty())
+		return llm_pipeline->object->generate(prompt, config, stream);
+
+	// the entries of the pipeline keep the text, apart from the tokens of the continuous batching pipeline
+	key = "text\x1d" + key;
+	auto function = std::get_if<std::function<bool(std::string)>>(&stream);
+	if (std::shared_ptr<const genai_completion> completion = cache->get(key)) {
+		if (function && !completion->text.empty())
+			(*function)(completion->text);
+		ov::genai::DecodedResults results;
+		results.texts.push_back(completion->text);
+		results.scores.push_back(completion->score);
+		return results;
+	}
+	auto stopped = std::make_shared<bool>(false);
+	if (function) {
+		stream = std::function<bool(std::string)>([stopped, callback = *function](std::string word) {
+			return *stopped = callback(std::move(word));
+		});
+	}
+	ov::genai::DecodedResults results = llm_pipeline->object->generate(prompt, config, stream);
+	bool cancelled = llm_pipeline->cancelled && llm_pipeline->cancelled->load(std::memory_order_relaxed);
+	if (!*stopped && !cancelled && results.texts.size() == 1) {
+		genai_completion completion;
+		completion.text = results.texts[0];
+		completion.score = results.scores.empty() ? 0.0f : results.scores[0];
+		cache->put(key, std::move(completion));
+	}
+	return results;
+}
+
+/**
+ * @brief Ends the chat of the pipeline, its messages staying in its session. A session which loses the KV cache of
+ * the pipeline prefills its whole history again on its next turn.
+ * @param evicted Whether to count it as an eviction of the sessions of the pipeline.
+ */
+static void leave_chat(ov_genai_llm_pipeline_t* llm_pipeline, bool evicted) {
+	std::shared_ptr<genai_chat_session> chat = std::move(llm_pipeline->chat);
+	llm_pipeline->chat = nullptr;
+	if (!chat || !chat->native)
+		return;
+	llm_pipeline->object->finish_chat();
+	chat->native = false;
+	if (evicted && !chat->id.empty() && llm_pipeline->sessions)
+		llm_pipeline->sessions->count_eviction();
+}
+
+// the chat sessions of the pipeline, created on first use
+static genai_chat_sessions& chat_sessions(ov_genai_llm_pipeline_t* llm_pipeline) {
+	if (!llm_pipeline->sessions)
+		llm_pipeline->sessions = std::make_shared<genai_chat_sessions>(ov_genai_chat_sessions_config_t{});
+	return *llm_pipeline->sessions;
+}
+
+static bool holds_session(const ov_genai_llm_pipeline_t* llm_pipeline) {
+	return llm_pipeline->chat && llm_pipeline->chat->native && !llm_pipeline->chat->id.empty();
+}
+
 int ov_genai_llm_sizeof()
 {
 	return sizeof(ov::genai::LLMPipeline);
@@ -35,11 +181,13 @@ ov_status_e ov_genai_llm_pipeline_create_with_model_path(
 	}
 
 	try {
-		ov::AnyMap property = {};
+		std::exception_ptr error;
 		va_list args_ptr;
-		va_start(args_ptr, device_name);
-		GET_PROPERTY_FROM_ARGS_LIST;
+		va_start(args_ptr, llm_pipeline);
+		ov::AnyMap property = properties_from_args_list(args_ptr, error);
 		va_end(args_ptr);
+		if (error)
+			std::rethrow_exception(error);
 
 		std::unique_ptr<ov_genai_llm_pipeline_t> _llm_pipeline(new ov_genai_llm_pipeline_t);
 		_llm_pipeline->object = std::make_shared<ov::genai::LLMPipeline>(model_path, device_name, property);
@@ -101,11 +249,13 @@ ov_status_e ov_genai_llm_pipeline_create_with_model_path_tokenizer(
 	}
 
 	try {
-		ov::AnyMap property = {};
+		std::exception_ptr error;
 		va_list args_ptr;
-		va_start(args_ptr, device_name);
-		GET_PROPERTY_FROM_ARGS_LIST;
+		va_start(args_ptr, llm_pipeline);
+		ov::AnyMap property = properties_from_args_list(args_ptr, error);
 		va_end(args_ptr);
+		if (error)
+			std::rethrow_exception(error);
 
 		std::unique_ptr<ov_genai_llm_pipeline_t> _llm_pipeline(new ov_genai_llm_pipeline_t);
 		_llm_pipeline->object = std::make_shared<ov::genai::LLMPipeline>(model_path, *tokenizer->object, device_name, property);
@@ -116,6 +266,66 @@ ov_status_e ov_genai_llm_pipeline_create_with_model_path_tokenizer(
 }
 
 
+ov_status_e ov_genai_llm_pipeline_create_with_draft_model(
+	const char* model_path,
+	const char* device_name,
+	const char* draft_model_path,
+	const char* draft_device_name,
+	ov_genai_llm_pipeline_t** llm_pipeline, ...) {
+
+	if (!model_path || !device_name || !draft_model_path || !draft_device_name || !llm_pipeline) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+
+	try {
+		std::exception_ptr error;
+		va_list args_ptr;
+		va_start(args_ptr, llm_pipeline);
+		ov::AnyMap property = properties_from_args_list(args_ptr, error);
+		va_end(args_ptr);
+		if (error)
+			std::rethrow_exception(error);
+		property.insert(ov::genai::draft_model(draft_model_path, draft_device_name));
+
+		std::unique_ptr<ov_genai_llm_pipeline_t> _llm_pipeline(new ov_genai_llm_pipeline_t);
+		_llm_pipeline->object = std::make_shared<ov::genai::LLMPipeline>(model_path, device_name, property);
+		_llm_pipeline->speculative = std::make_shared<genai_speculative_counters>();
+		*llm_pipeline = _llm_pipeline.release();
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
+
+
+ov_status_e ov_genai_llm_pipeline_create_with_prompt_lookup(
+	const char* model_path,
+	const char* device_name,
+	ov_genai_llm_pipeline_t** llm_pipeline, ...) {
+
+	if (!model_path || !device_name || !llm_pipeline) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+
+	try {
+		std::exception_ptr error;
+		va_list args_ptr;
+		va_start(args_ptr, llm_pipeline);
+		ov::AnyMap property = properties_from_args_list(args_ptr, error);
+		va_end(args_ptr);
+		if (error)
+			std::rethrow_exception(error);
+		property.insert(ov::genai::prompt_lookup(true));
+
+		std::unique_ptr<ov_genai_llm_pipeline_t> _llm_pipeline(new ov_genai_llm_pipeline_t);
+		_llm_pipeline->object = std::make_shared<ov::genai::LLMPipeline>(model_path, device_name, property);
+		_llm_pipeline->speculative = std::make_shared<genai_speculative_counters>();
+		*llm_pipeline = _llm_pipeline.release();
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
+
+
 
 void ov_genai_llm_pipeline_free(
 	ov_genai_llm_pipeline_t* llm_pipeline) {
@@ -126,6 +336,73 @@ void ov_genai_llm_pipeline_free(
 
 
 
+ov_status_e ov_genai_llm_pipeline_set_cancellation_token(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	const ov_genai_cancellation_token_t* cancellation_token) {
+
+	if (!llm_pipeline) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+	llm_pipeline->cancelled = cancellation_token ? cancellation_token->object : nullptr;
+	return ov_status_e::OK;
+}
+
+
+ov_status_e ov_genai_llm_pipeline_set_completion_cache(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	const ov_genai_completion_cache_config_t* cache_config) {
+
+	if (!llm_pipeline || (cache_config && cache_config->disk_path && !cache_config->model_id)) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+
+	try {
+		// the current cache lets go of its file first, a new cache of the same file could not lock it
+		std::atomic_store(&llm_pipeline->completion_cache, std::shared_ptr<genai_completion_cache>());
+		std::shared_ptr<genai_completion_cache> cache;
+		if (cache_config)
+			cache = std::make_shared<genai_completion_cache>(*cache_config);
+		std::atomic_store(&llm_pipeline->completion_cache, cache);
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
+
+
+ov_status_e ov_genai_llm_pipeline_get_completion_cache_stats(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	ov_genai_completion_cache_stats_t* cache_stats) {
+
+	if (!llm_pipeline || !cache_stats) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+
+	try {
+		*cache_stats = ov_genai_completion_cache_stats_t{};
+		if (std::shared_ptr<genai_completion_cache> cache = std::atomic_load(&llm_pipeline->completion_cache))
+			cache->get_stats(cache_stats);
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_llm_pipeline_get_speculative_metrics(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	ov_genai_speculative_metrics_t* speculative_metrics) {
+
+	if (!llm_pipeline || !speculative_metrics) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+
+	try {
+		*speculative_metrics = llm_pipeline->speculative ? llm_pipeline->speculative->get()
+			: ov_genai_speculative_metrics_t{};
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
+
+
 ov_status_e ov_genai_llm_pipeline_generate_string(
 	ov_genai_llm_pipeline_t* llm_pipeline,
 	const char* inputs,
@@ -138,7 +415,10 @@ ov_status_e ov_genai_llm_pipeline_generate_string(
 
 	try {
 		ov::genai::DecodedResults object;
-		object = llm_pipeline->object->generate(inputs);
+		genai_trace_request trace;
+		object = generate_prompt(llm_pipeline, inputs, std::nullopt, std::monostate());
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, std::nullopt, object.perf_metrics);
 		std::unique_ptr<ov_genai_decoded_results_t> _decoded_results(new ov_genai_decoded_results_t);
 		_decoded_results->object = std::make_shared<ov::genai::DecodedResults>(std::move(object));
 		*decoded_results = _decoded_results.release();
@@ -160,7 +440,11 @@ ov_status_e ov_genai_llm_pipeline_generate_strings(
 
 	try {
 		ov::genai::DecodedResults object;
-		object = llm_pipeline->object->generate(char_arrays_to_str_array(*inputs_array));
+		genai_trace_request trace;
+		object = llm_pipeline->object->generate(char_arrays_to_str_array(*inputs_array), std::nullopt,
+			cancellable(llm_pipeline, std::monostate(), std::nullopt, inputs_array->size));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, std::nullopt, object.perf_metrics);
 		std::unique_ptr<ov_genai_decoded_results_t> _decoded_results(new ov_genai_decoded_results_t);
 		_decoded_results->object = std::make_shared<ov::genai::DecodedResults>(std::move(object));
 		*decoded_results = _decoded_results.release();
@@ -183,7 +467,10 @@ ov_status_e ov_genai_llm_pipeline_generate_string_with_config(
 
 	try {
 		ov::genai::DecodedResults object;
-		object = llm_pipeline->object->generate(inputs, *generation_config->object);
+		genai_trace_request trace;
+		object = generate_prompt(llm_pipeline, inputs, *generation_config->object, std::monostate());
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, *generation_config->object, object.perf_metrics);
 		std::unique_ptr<ov_genai_decoded_results_t> _decoded_results(new ov_genai_decoded_results_t);
 		_decoded_results->object = std::make_shared<ov::genai::DecodedResults>(std::move(object));
 		*decoded_results = _decoded_results.release();
@@ -206,7 +493,11 @@ ov_status_e ov_genai_llm_pipeline_generate_strings_with_config(
 
 	try {
 		ov::genai::DecodedResults object;
-		object = llm_pipeline->object->generate(char_arrays_to_str_array(*inputs_array), *generation_config->object);
+		genai_trace_request trace;
+		object = llm_pipeline->object->generate(char_arrays_to_str_array(*inputs_array), *generation_config->object,
+			cancellable(llm_pipeline, std::monostate(), *generation_config->object, inputs_array->size));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, *generation_config->object, object.perf_metrics);
 		std::unique_ptr<ov_genai_decoded_results_t> _decoded_results(new ov_genai_decoded_results_t);
 		_decoded_results->object = std::make_shared<ov::genai::DecodedResults>(std::move(object));
 		*decoded_results = _decoded_results.release();
@@ -229,7 +520,10 @@ ov_status_e ov_genai_llm_pipeline_generate_string_with_function(
 
 	try {
 		ov::genai::DecodedResults object;
-		object = llm_pipeline->object->generate(inputs, std::nullopt,*callback);
+		genai_trace_request trace;
+		object = generate_prompt(llm_pipeline, inputs, std::nullopt, trace.streamer(callback));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, std::nullopt, object.perf_metrics);
 		std::unique_ptr<ov_genai_decoded_results_t> _decoded_results(new ov_genai_decoded_results_t);
 		_decoded_results->object = std::make_shared<ov::genai::DecodedResults>(std::move(object));
 		*decoded_results = _decoded_results.release();
@@ -252,7 +546,11 @@ ov_status_e ov_genai_llm_pipeline_generate_strings_with_function(
 
 	try {
 		ov::genai::DecodedResults object;
-		object = llm_pipeline->object->generate(char_arrays_to_str_array(*inputs_array), std::nullopt, *callback);
+		genai_trace_request trace;
+		object = llm_pipeline->object->generate(char_arrays_to_str_array(*inputs_array), std::nullopt,
+			cancellable(llm_pipeline, trace.streamer(callback), std::nullopt, inputs_array->size));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, std::nullopt, object.perf_metrics);
 		std::unique_ptr<ov_genai_decoded_results_t> _decoded_results(new ov_genai_decoded_results_t);
 		_decoded_results->object = std::make_shared<ov::genai::DecodedResults>(std::move(object));
 		*decoded_results = _decoded_results.release();
@@ -276,7 +574,10 @@ ov_status_e ov_genai_llm_pipeline_generate_string_with_config_function(
 
 	try {
 		ov::genai::DecodedResults object;
-		object = llm_pipeline->object->generate(inputs, *generation_config->object, *callback);
+		genai_trace_request trace;
+		object = generate_prompt(llm_pipeline, inputs, *generation_config->object, trace.streamer(callback));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, *generation_config->object, object.perf_metrics);
 		std::unique_ptr<ov_genai_decoded_results_t> _decoded_results(new ov_genai_decoded_results_t);
 		_decoded_results->object = std::make_shared<ov::genai::DecodedResults>(std::move(object));
 		*decoded_results = _decoded_results.release();
@@ -300,7 +601,11 @@ ov_status_e ov_genai_llm_pipeline_generate_strings_with_config_function(
 
 	try {
 		ov::genai::DecodedResults object;
-		object = llm_pipeline->object->generate(char_arrays_to_str_array(*inputs_array), *generation_config->object, *callback);
+		genai_trace_request trace;
+		object = llm_pipeline->object->generate(char_arrays_to_str_array(*inputs_array), *generation_config->object,
+			cancellable(llm_pipeline, trace.streamer(callback), *generation_config->object, inputs_array->size));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, *generation_config->object, object.perf_metrics);
 		std::unique_ptr<ov_genai_decoded_results_t> _decoded_results(new ov_genai_decoded_results_t);
 		_decoded_results->object = std::make_shared<ov::genai::DecodedResults>(std::move(object));
 		*decoded_results = _decoded_results.release();
@@ -311,19 +616,50 @@ ov_status_e ov_genai_llm_pipeline_generate_strings_with_config_function(
 
 
 
+ov_status_e ov_genai_llm_pipeline_generate_string_with_streamer(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	const char* inputs,
+	const ov_genai_generation_config_t* generation_config,
+	const ov_genai_streamer_t* streamer,
+	ov_genai_decoded_results_t** decoded_results) {
+
+	if (!llm_pipeline || !inputs || !streamer || !streamer->callback || !decoded_results) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+
+	try {
+		ov::genai::OptionalGenerationConfig config = std::nullopt;
+		if (generation_config)
+			config = *generation_config->object;
+		genai_trace_request trace;
+		ov::genai::DecodedResults object = generate_prompt(llm_pipeline, inputs, config, trace.streamer(streamer));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, config, object.perf_metrics);
+		std::unique_ptr<ov_genai_decoded_results_t> _decoded_results(new ov_genai_decoded_results_t);
+		_decoded_results->object = std::make_shared<ov::genai::DecodedResults>(std::move(object));
+		*decoded_results = _decoded_results.release();
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
+
 ov_status_e ov_genai_llm_pipeline_generate_string_with_config_map(
 	ov_genai_llm_pipeline_t* llm_pipeline,
 	const char* inputs,
 	const generation_config_param_t config_param,
 	ov_genai_decoded_results_t** decoded_results){
 
-	if (!llm_pipeline || !decoded_results) {
+	if (!llm_pipeline || !decoded_results || !generation_config_param_is_valid(config_param)) {
 		return ov_status_e::INVALID_C_PARAM;
 	}
 
 	try {
 		ov::genai::DecodedResults object;
-		object = llm_pipeline->object->generate(inputs, generation_config_param_to_anymap(config_param));
+		genai_trace_request trace;
+		ov::genai::GenerationConfig config = config_from_param(llm_pipeline, config_param);
+		object = generate_prompt(llm_pipeline, inputs, config, std::monostate());
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, config, object.perf_metrics);
 		std::unique_ptr<ov_genai_decoded_results_t> _decoded_results(new ov_genai_decoded_results_t);
 		_decoded_results->object = std::make_shared<ov::genai::DecodedResults>(std::move(object));
 		*decoded_results = _decoded_results.release();
@@ -340,13 +676,17 @@ ov_status_e ov_genai_llm_pipeline_generate_strings_with_config_map(
 	const generation_config_param_t config_param,
 	ov_genai_decoded_results_t** decoded_results){
 
-	if (!llm_pipeline || !decoded_results) {
+	if (!llm_pipeline || !decoded_results || !generation_config_param_is_valid(config_param)) {
 		return ov_status_e::INVALID_C_PARAM;
 	}
 
 	try {
 		ov::genai::DecodedResults object;
-		object = llm_pipeline->object->generate(char_arrays_to_str_array(*inputs_array), generation_config_param_to_anymap(config_param));
+		genai_trace_request trace;
+		ov::genai::GenerationConfig config = config_from_param(llm_pipeline, config_param);
+		object = llm_pipeline->object->generate(char_arrays_to_str_array(*inputs_array), config, cancellable(llm_pipeline, std::monostate(), config, inputs_array->size));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, config, object.perf_metrics);
 		std::unique_ptr<ov_genai_decoded_results_t> _decoded_results(new ov_genai_decoded_results_t);
 		_decoded_results->object = std::make_shared<ov::genai::DecodedResults>(std::move(object));
 		*decoded_results = _decoded_results.release();
@@ -368,7 +708,11 @@ ov_status_e ov_genai_llm_pipeline_generate_tensor(
 
 	try {
 		ov::genai::EncodedResults object;
-		object = llm_pipeline->object->generate(*tensor->object);
+		genai_trace_request trace;
+		object = llm_pipeline->object->generate(*tensor->object, std::nullopt,
+			cancellable(llm_pipeline, std::monostate(), std::nullopt, batch_size(*tensor->object)));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, std::nullopt, object.perf_metrics);
 		std::unique_ptr<ov_genai_encoded_results_t> _encoded_results(new ov_genai_encoded_results_t);
 		_encoded_results->object = std::make_shared<ov::genai::EncodedResults>(std::move(object));
 		*encoded_results = _encoded_results.release();
@@ -389,7 +733,11 @@ ov_status_e ov_genai_llm_pipeline_generate_tokenized_inputs(
 
 	try {
 		ov::genai::EncodedResults object;
-		object = llm_pipeline->object->generate(*tokenized_inputs->object);
+		genai_trace_request trace;
+		object = llm_pipeline->object->generate(*tokenized_inputs->object, std::nullopt,
+			cancellable(llm_pipeline, std::monostate(), std::nullopt, batch_size(tokenized_inputs->object->input_ids)));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, std::nullopt, object.perf_metrics);
 		std::unique_ptr<ov_genai_encoded_results_t> _encoded_results(new ov_genai_encoded_results_t);
 		_encoded_results->object = std::make_shared<ov::genai::EncodedResults>(std::move(object));
 		*encoded_results = _encoded_results.release();
@@ -412,7 +760,11 @@ ov_status_e ov_genai_llm_pipeline_generate_tensor_with_config(
 
 	try {
 		ov::genai::EncodedResults object;
-		object = llm_pipeline->object->generate(*tensor->object, *generation_config->object);
+		genai_trace_request trace;
+		object = llm_pipeline->object->generate(*tensor->object, *generation_config->object,
+			cancellable(llm_pipeline, std::monostate(), *generation_config->object, batch_size(*tensor->object)));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, *generation_config->object, object.perf_metrics);
 		std::unique_ptr<ov_genai_encoded_results_t> _encoded_results(new ov_genai_encoded_results_t);
 		_encoded_results->object = std::make_shared<ov::genai::EncodedResults>(std::move(object));
 		*encoded_results = _encoded_results.release();
@@ -434,7 +786,12 @@ ov_status_e ov_genai_llm_pipeline_generate_tokenized_inputs_with_config(
 
 	try {
 		ov::genai::EncodedResults object;
-		object = llm_pipeline->object->generate(*tokenized_inputs->object, *generation_config->object);
+		genai_trace_request trace;
+		object = llm_pipeline->object->generate(*tokenized_inputs->object, *generation_config->object,
+			cancellable(llm_pipeline, std::monostate(), *generation_config->object,
+				batch_size(tokenized_inputs->object->input_ids)));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, *generation_config->object, object.perf_metrics);
 		std::unique_ptr<ov_genai_encoded_results_t> _encoded_results(new ov_genai_encoded_results_t);
 		_encoded_results->object = std::make_shared<ov::genai::EncodedResults>(std::move(object));
 		*encoded_results = _encoded_results.release();
@@ -456,7 +813,11 @@ ov_status_e ov_genai_llm_pipeline_generate_tensor_with_function(
 
 	try {
 		ov::genai::EncodedResults object;
-		object = llm_pipeline->object->generate(*tensor->object, std::nullopt, *callback);
+		genai_trace_request trace;
+		object = llm_pipeline->object->generate(*tensor->object, std::nullopt,
+			cancellable(llm_pipeline, trace.streamer(callback), std::nullopt, batch_size(*tensor->object)));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, std::nullopt, object.perf_metrics);
 		std::unique_ptr<ov_genai_encoded_results_t> _encoded_results(new ov_genai_encoded_results_t);
 		_encoded_results->object = std::make_shared<ov::genai::EncodedResults>(std::move(object));
 		*encoded_results = _encoded_results.release();
@@ -478,7 +839,11 @@ ov_status_e ov_genai_llm_pipeline_generate_tokenized_inputs_with_function(
 
 	try {
 		ov::genai::EncodedResults object;
-		object = llm_pipeline->object->generate(*tokenized_inputs->object, std::nullopt, *callback);
+		genai_trace_request trace;
+		object = llm_pipeline->object->generate(*tokenized_inputs->object, std::nullopt,
+			cancellable(llm_pipeline, trace.streamer(callback), std::nullopt, batch_size(tokenized_inputs->object->input_ids)));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, std::nullopt, object.perf_metrics);
 		std::unique_ptr<ov_genai_encoded_results_t> _encoded_results(new ov_genai_encoded_results_t);
 		_encoded_results->object = std::make_shared<ov::genai::EncodedResults>(std::move(object));
 		*encoded_results = _encoded_results.release();
@@ -502,7 +867,11 @@ ov_status_e ov_genai_llm_pipeline_generate_tensor_with_config_function(
 
 	try {
 		ov::genai::EncodedResults object;
-		object = llm_pipeline->object->generate(*tensor->object, *generation_config->object, *callback);
+		genai_trace_request trace;
+		object = llm_pipeline->object->generate(*tensor->object, *generation_config->object,
+			cancellable(llm_pipeline, trace.streamer(callback), *generation_config->object, batch_size(*tensor->object)));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, *generation_config->object, object.perf_metrics);
 		std::unique_ptr<ov_genai_encoded_results_t> _encoded_results(new ov_genai_encoded_results_t);
 		_encoded_results->object = std::make_shared<ov::genai::EncodedResults>(std::move(object));
 		*encoded_results = _encoded_results.release();
@@ -525,7 +894,12 @@ ov_status_e ov_genai_llm_pipeline_generate_tokenized_inputs_with_config_function
 
 	try {
 		ov::genai::EncodedResults object;
-		object = llm_pipeline->object->generate(*tokenized_inputs->object, *generation_config->object, *callback);
+		genai_trace_request trace;
+		object = llm_pipeline->object->generate(*tokenized_inputs->object, *generation_config->object,
+			cancellable(llm_pipeline, trace.streamer(callback), *generation_config->object,
+				batch_size(tokenized_inputs->object->input_ids)));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, *generation_config->object, object.perf_metrics);
 		std::unique_ptr<ov_genai_encoded_results_t> _encoded_results(new ov_genai_encoded_results_t);
 		_encoded_results->object = std::make_shared<ov::genai::EncodedResults>(std::move(object));
 		*encoded_results = _encoded_results.release();
@@ -542,13 +916,17 @@ ov_status_e ov_genai_llm_pipeline_generate_tensor_with_config_map(
 	const generation_config_param_t config_param,
 	ov_genai_encoded_results_t** encoded_results){
 
-	if (!llm_pipeline || !tensor || !encoded_results) {
+	if (!llm_pipeline || !tensor || !encoded_results || !generation_config_param_is_valid(config_param)) {
 		return ov_status_e::INVALID_C_PARAM;
 	}
 
 	try {
 		ov::genai::EncodedResults object;
-		object = llm_pipeline->object->generate(*tensor->object, generation_config_param_to_anymap(config_param));
+		genai_trace_request trace;
+		ov::genai::GenerationConfig config = config_from_param(llm_pipeline, config_param);
+		object = llm_pipeline->object->generate(*tensor->object, config, cancellable(llm_pipeline, std::monostate(), config, batch_size(*tensor->object)));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, config, object.perf_metrics);
 		std::unique_ptr<ov_genai_encoded_results_t> _encoded_results(new ov_genai_encoded_results_t);
 		_encoded_results->object = std::make_shared<ov::genai::EncodedResults>(std::move(object));
 		*encoded_results = _encoded_results.release();
@@ -564,13 +942,18 @@ ov_status_e ov_genai_llm_pipeline_generate_tokenized_inputs_with_config_map(
 	const generation_config_param_t config_param,
 	ov_genai_encoded_results_t** encoded_results){
 
-	if (!llm_pipeline || !tokenized_inputs || !encoded_results) {
+	if (!llm_pipeline || !tokenized_inputs || !encoded_results
+		|| !generation_config_param_is_valid(config_param)) {
 		return ov_status_e::INVALID_C_PARAM;
 	}
 
 	try {
 		ov::genai::EncodedResults object;
-		object = llm_pipeline->object->generate(*tokenized_inputs->object, generation_config_param_to_anymap(config_param));
+		genai_trace_request trace;
+		ov::genai::GenerationConfig config = config_from_param(llm_pipeline, config_param);
+		object = llm_pipeline->object->generate(*tokenized_inputs->object, config, cancellable(llm_pipeline, std::monostate(), config, batch_size(tokenized_inputs->object->input_ids)));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, config, object.perf_metrics);
 		std::unique_ptr<ov_genai_encoded_results_t> _encoded_results(new ov_genai_encoded_results_t);
 		_encoded_results->object = std::make_shared<ov::genai::EncodedResults>(std::move(object));
 		*encoded_results = _encoded_results.release();
@@ -642,7 +1025,9 @@ ov_status_e ov_genai_llm_pipeline_generate_start_chat(
 	}
 
 	try {
+		leave_chat(llm_pipeline, true);
 		llm_pipeline->object->start_chat();
+		llm_pipeline->chat = std::make_shared<genai_chat_session>();
 	}
 	CATCH_OV_GENAI_EXCEPTIONS
 		return ov_status_e::OK;
@@ -657,7 +1042,169 @@ ov_status_e ov_genai_llm_pipeline_generate_finish_chat(
 	}
 
 	try {
-		llm_pipeline->object->finish_chat();
+		// leave_chat finishes the chat it started, the pipeline is only told directly when there was none
+		bool wrapped = llm_pipeline->chat != nullptr;
+		leave_chat(llm_pipeline, false);
+		if (!wrapped)
+			llm_pipeline->object->finish_chat();
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_llm_pipeline_export_chat(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	char** blob,
+	size_t* blob_size) {
+
+	if (!llm_pipeline || !blob || !blob_size) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+
+	try {
+		if (!llm_pipeline->chat)
+			OPENVINO_THROW("The pipeline has no chat to export");
+		std::vector<char> serialized = genai_serialize_chat(llm_pipeline->chat->snapshot());
+		std::unique_ptr<char[]> _blob(new char[serialized.size()]);
+		std::copy(serialized.begin(), serialized.end(), _blob.get());
+		*blob_size = serialized.size();
+		*blob = _blob.release();
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_llm_pipeline_import_chat(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	const char* blob,
+	size_t blob_size) {
+
+	if (!llm_pipeline || !blob) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+
+	try {
+		auto chat = std::make_shared<genai_chat_session>();
+		chat->history = genai_deserialize_chat(blob, blob_size);
+		chat->native = false;
+		leave_chat(llm_pipeline, true);
+		llm_pipeline->chat = std::move(chat);
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_llm_pipeline_set_chat_sessions(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	const ov_genai_chat_sessions_config_t* sessions_config) {
+
+	if (!llm_pipeline) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+
+	try {
+		std::shared_ptr<genai_chat_sessions> sessions;
+		if (sessions_config)
+			sessions = std::make_shared<genai_chat_sessions>(*sessions_config);
+		if (llm_pipeline->chat && !llm_pipeline->chat->id.empty())
+			leave_chat(llm_pipeline, false);
+		llm_pipeline->sessions = std::move(sessions);
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_llm_pipeline_generate_in_session(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	const char* session_id,
+	const char* inputs,
+	const ov_genai_generation_config_t* generation_config,
+	const ov_genai_streamer_t* streamer,
+	ov_genai_decoded_results_t** decoded_results) {
+
+	if (!llm_pipeline || !session_id || !inputs || (streamer && !streamer->callback) || !decoded_results) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+
+	try {
+		genai_chat_sessions& sessions = chat_sessions(llm_pipeline);
+		std::shared_ptr<genai_chat_session> session = sessions.open(session_id);
+		if (llm_pipeline->chat != session) {
+			// the pipeline has one chat, the KV cache goes to the session of the latest turn
+			leave_chat(llm_pipeline, true);
+			if (session->snapshot().empty()) {
+				llm_pipeline->object->start_chat();
+				session->native = true;
+			}
+			llm_pipeline->chat = session;
+		}
+		sessions.count_turn(!session->native);
+
+		ov::genai::OptionalGenerationConfig config = std::nullopt;
+		if (generation_config)
+			config = *generation_config->object;
+		genai_trace_request trace;
+		ov::genai::DecodedResults object = generate_prompt(llm_pipeline, inputs, config,
+			streamer ? trace.streamer(streamer) : ov::genai::StreamerVariant(std::monostate()));
+		trace.finish(&object.perf_metrics);
+		count_speculative(llm_pipeline, config, object.perf_metrics);
+		std::unique_ptr<ov_genai_decoded_results_t> _decoded_results(new ov_genai_decoded_results_t);
+		_decoded_results->object = std::make_shared<ov::genai::DecodedResults>(std::move(object));
+		*decoded_results = _decoded_results.release();
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_llm_pipeline_evict_idle_sessions(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	size_t* evicted) {
+
+	if (!llm_pipeline || !evicted) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+
+	try {
+		*evicted = 0;
+		if (holds_session(llm_pipeline) && llm_pipeline->sessions->idle(*llm_pipeline->chat)) {
+			leave_chat(llm_pipeline, true);
+			*evicted = 1;
+		}
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_llm_pipeline_end_session(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	const char* session_id) {
+
+	if (!llm_pipeline || !session_id) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+
+	try {
+		if (llm_pipeline->chat && llm_pipeline->chat->id == session_id)
+			leave_chat(llm_pipeline, false);
+		if (llm_pipeline->sessions)
+			llm_pipeline->sessions->end(session_id);
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_llm_pipeline_get_chat_sessions_stats(
+	ov_genai_llm_pipeline_t* llm_pipeline,
+	ov_genai_chat_sessions_stats_t* sessions_stats) {
+
+	if (!llm_pipeline || !sessions_stats) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+
+	try {
+		*sessions_stats = ov_genai_chat_sessions_stats_t{};
+		if (llm_pipeline->sessions)
+			llm_pipeline->sessions->get_stats(sessions_stats, holds_session(llm_pipeline) ? 1 : 0);
 	}
 	CATCH_OV_GENAI_EXCEPTIONS
 		return ov_status_e::OK;
@@ -283,4 +283,24 @@ ov_genai_operator_add(
 	}
 	CATCH_OV_GENAI_EXCEPTIONS
 		return ov_status_e::OK;
-}
\ No newline at end of file
+}
+
+ov_status_e
+ov_genai_perf_metrics_get_raw_metrics(
+	ov_genai_perf_metrics_t* perf_metrics,
+	ov_genai_raw_perf_metrics_t** raw_perf_metrics) {
+
+	if (!perf_metrics || !raw_perf_metrics) {
+		return ov_status_e::INVALID_C_PARAM;
+	}
+
+	try {
+		std::unique_ptr<ov_genai_raw_perf_metrics_t> _raw_perf_metrics(new ov_genai_raw_perf_metrics_t);
+		// Aliasing constructor: keeps perf_metrics alive and points into its raw_metrics member.
+		_raw_perf_metrics->object = std::shared_ptr<ov::genai::RawPerfMetrics>(
+			perf_metrics->object, &perf_metrics->object->raw_metrics);
+		*raw_perf_metrics = _raw_perf_metrics.release();
+	}
+	CATCH_OV_GENAI_EXCEPTIONS
+		return ov_status_e::OK;
+}
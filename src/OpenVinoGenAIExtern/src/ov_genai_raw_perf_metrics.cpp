@@ -16,6 +16,16 @@
 #include "genai_common.h"
 #include <cstdarg>
 
+static_assert(sizeof(MicroSeconds) == sizeof(float), "MicroSeconds must be layout compatible with float");
+static_assert(sizeof(TimePoint) == sizeof(int64_t), "TimePoint must be layout compatible with int64_t");
+
+/**
+ * @brief Borrow the storage of a std::vector<MicroSeconds> as a float array.
+ */
+static const float* durations_data(const std::vector<MicroSeconds>& durations) {
+    return durations.empty() ? nullptr : reinterpret_cast<const float*>(durations.data());
+}
+
 
 ov_status_e ov_genai_raw_perf_metrics_create(
 	ov_genai_raw_perf_metrics_t** raw_perf_metrics) {
@@ -50,7 +60,7 @@ ov_genai_raw_perf_metrics_get_generate_durations(
     }
 
     try {
-        auto tmp = raw_perf_metrics->object->generate_durations;
+        const auto& tmp = raw_perf_metrics->object->generate_durations;
         *length = tmp.size();
         float* array = new float[*length];
 
@@ -94,7 +104,7 @@ ov_genai_raw_perf_metrics_get_tokenization_durations(
     }
 
     try {
-        auto tmp = raw_perf_metrics->object->tokenization_durations;
+        const auto& tmp = raw_perf_metrics->object->tokenization_durations;
         *length = tmp.size();
         float* array = new float[*length];
 
@@ -138,7 +148,7 @@ ov_genai_raw_perf_metrics_get_detokenization_durations(
     }
 
     try {
-        auto tmp = raw_perf_metrics->object->detokenization_durations;
+        const auto& tmp = raw_perf_metrics->object->detokenization_durations;
         *length = tmp.size();
         float* array = new float[*length];
 
@@ -183,7 +193,7 @@ ov_genai_raw_perf_metrics_get_m_times_to_first_token(
     }
 
     try {
-        auto tmp = raw_perf_metrics->object->m_times_to_first_token;
+        const auto& tmp = raw_perf_metrics->object->m_times_to_first_token;
         *length = tmp.size();
         float* array = new float[*length];
 
@@ -228,7 +238,7 @@ ov_genai_raw_perf_metrics_get_m_new_token_times(
     }
 
     try {
-        auto tmp = raw_perf_metrics->object->m_new_token_times;
+        const auto& tmp = raw_perf_metrics->object->m_new_token_times;
         *length = tmp.size();
         size_t* array = new size_t[*length];
 
@@ -273,7 +283,7 @@ ov_genai_raw_perf_metrics_get_m_batch_sizes(
     }
 
     try {
-        auto tmp = raw_perf_metrics->object->m_batch_sizes;
+        const auto& tmp = raw_perf_metrics->object->m_batch_sizes;
         *length = tmp.size();
         size_t* array = new size_t[*length];
 
@@ -318,7 +328,7 @@ ov_genai_raw_perf_metrics_get_m_durations(
     }
 
     try {
-        auto tmp = raw_perf_metrics->object->m_durations;
+        const auto& tmp = raw_perf_metrics->object->m_durations;
         *length = tmp.size();
         float* array = new float[*length];
 
@@ -351,3 +361,74 @@ ov_genai_raw_perf_metrics_set_m_durations(
     CATCH_OV_GENAI_EXCEPTIONS
         return ov_status_e::OK;
 }
+
+ov_status_e
+ov_genai_raw_perf_metrics_get_durations_view(
+    const ov_genai_raw_perf_metrics_t* raw_perf_metrics,
+    ov_genai_raw_perf_metrics_durations_e series,
+    const float** micro_seconds,
+    size_t* length) {
+
+    if (!raw_perf_metrics || !micro_seconds || !length) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        const ov::genai::RawPerfMetrics& object = *raw_perf_metrics->object;
+        const std::vector<MicroSeconds>* durations = nullptr;
+        switch (series) {
+        case RAW_GENERATE_DURATIONS:
+            durations = &object.generate_durations;
+            break;
+        case RAW_TOKENIZATION_DURATIONS:
+            durations = &object.tokenization_durations;
+            break;
+        case RAW_DETOKENIZATION_DURATIONS:
+            durations = &object.detokenization_durations;
+            break;
+        case RAW_TIMES_TO_FIRST_TOKEN:
+            durations = &object.m_times_to_first_token;
+            break;
+        case RAW_DURATIONS:
+            durations = &object.m_durations;
+            break;
+        default:
+            return ov_status_e::OUT_OF_BOUNDS;
+        }
+        *micro_seconds = durations_data(*durations);
+        *length = durations->size();
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e
+ov_genai_raw_perf_metrics_get_views(
+    const ov_genai_raw_perf_metrics_t* raw_perf_metrics,
+    ov_genai_raw_perf_metrics_views_t* views) {
+
+    if (!raw_perf_metrics || !views) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        const ov::genai::RawPerfMetrics& object = *raw_perf_metrics->object;
+        views->generate_durations = durations_data(object.generate_durations);
+        views->generate_durations_size = object.generate_durations.size();
+        views->tokenization_durations = durations_data(object.tokenization_durations);
+        views->tokenization_durations_size = object.tokenization_durations.size();
+        views->detokenization_durations = durations_data(object.detokenization_durations);
+        views->detokenization_durations_size = object.detokenization_durations.size();
+        views->m_times_to_first_token = durations_data(object.m_times_to_first_token);
+        views->m_times_to_first_token_size = object.m_times_to_first_token.size();
+        views->m_new_token_times = object.m_new_token_times.empty()
+            ? nullptr : reinterpret_cast<const int64_t*>(object.m_new_token_times.data());
+        views->m_new_token_times_size = object.m_new_token_times.size();
+        views->m_batch_sizes = object.m_batch_sizes.empty() ? nullptr : object.m_batch_sizes.data();
+        views->m_batch_sizes_size = object.m_batch_sizes.size();
+        views->m_durations = durations_data(object.m_durations);
+        views->m_durations_size = object.m_durations.size();
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
@@ -0,0 +1,319 @@
+// Copyright (C) 2024 Yan Guojin
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+* @file ov_genai_trace.cpp
+* @brief This is a source file for the ov_genai_trace C API, an opt-in per-request span tracer for the pipelines.
+* @version 1.0
+* @author Yan Guojin guojin_yjs@cumt.edu.cn
+* @date 2024/10/19
+*/
+
+#include "ov_genai_trace.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "genai_trace.h"
+
+std::atomic<bool> genai_trace_enabled_flag{ false };
+
+/**
+ * @struct genai_trace_event
+ * @brief A plain copy of one recorded span.
+ */
+struct genai_trace_event {
+    uint32_t kind;
+    uint32_t thread_id;
+    uint64_t request_id;
+    int64_t begin_ns;
+    int64_t end_ns;
+};
+
+/**
+ * @struct genai_trace_slot
+ * @brief One ring slot, guarded by a sequence number so readers never block writers.
+ * sequence is 0 while the slot is written and index + 1 once it holds the span pushed at index.
+ */
+struct genai_trace_slot {
+    std::atomic<uint64_t> sequence{ 0 };
+    std::atomic<uint32_t> kind{ 0 };
+    std::atomic<uint32_t> thread_id{ 0 };
+    std::atomic<uint64_t> request_id{ 0 };
+    std::atomic<int64_t> begin_ns{ 0 };
+    std::atomic<int64_t> end_ns{ 0 };
+};
+
+/**
+ * @struct genai_trace_ring
+ * @brief Multi-producer ring of spans. Writers claim a slot with one fetch_add and overwrite the oldest span.
+ */
+struct genai_trace_ring {
+    explicit genai_trace_ring(size_t capacity)
+        : capacity(capacity), slots(new genai_trace_slot[capacity]) {}
+
+    const size_t capacity;
+    std::unique_ptr<genai_trace_slot[]> slots;
+    std::atomic<uint64_t> head{ 0 };
+    std::atomic<uint64_t> cleared{ 0 };
+
+    void push(const genai_trace_event& event) {
+        uint64_t index = head.fetch_add(1, std::memory_order_relaxed);
+        genai_trace_slot& slot = slots[index & (capacity - 1)];
+        slot.sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.kind.store(event.kind, std::memory_order_relaxed);
+        slot.thread_id.store(event.thread_id, std::memory_order_relaxed);
+        slot.request_id.store(event.request_id, std::memory_order_relaxed);
+        slot.begin_ns.store(event.begin_ns, std::memory_order_relaxed);
+        slot.end_ns.store(event.end_ns, std::memory_order_relaxed);
+        slot.sequence.store(index + 1, std::memory_order_release);
+    }
+
+    std::vector<genai_trace_event> snapshot() const {
+        std::vector<genai_trace_event> events;
+        uint64_t end = head.load(std::memory_order_acquire);
+        uint64_t begin = end > capacity ? end - capacity : 0;
+        begin = std::max(begin, cleared.load(std::memory_order_relaxed));
+        events.reserve(static_cast<size_t>(end - begin));
+        for (uint64_t index = begin; index < end; ++index) {
+            const genai_trace_slot& slot = slots[index & (capacity - 1)];
+            uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence != index + 1)
+                continue;
+            genai_trace_event event;
+            event.kind = slot.kind.load(std::memory_order_relaxed);
+            event.thread_id = slot.thread_id.load(std::memory_order_relaxed);
+            event.request_id = slot.request_id.load(std::memory_order_relaxed);
+            event.begin_ns = slot.begin_ns.load(std::memory_order_relaxed);
+            event.end_ns = slot.end_ns.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != sequence)
+                continue;
+            events.push_back(event);
+        }
+        return events;
+    }
+};
+
+static std::atomic<genai_trace_ring*> trace_ring{ nullptr };
+static std::atomic<uint64_t> trace_request_ids{ 1 };
+static std::atomic<uint32_t> trace_thread_ids{ 1 };
+// Guards trace_ring_owner and the readers of the ring.
+static std::mutex trace_mutex;
+static std::unique_ptr<genai_trace_ring> trace_ring_owner;
+// A writer registers in the counter of the current epoch before it loads trace_ring. A replaced ring is released
+// once the counter of the epoch it was published in drains, the writers which come later see the new ring.
+static std::atomic<uint32_t> trace_epoch{ 0 };
+static std::atomic<size_t> trace_writers[2];
+static const size_t trace_max_capacity = size_t(1) << 22;
+
+static uint32_t genai_trace_thread_id() {
+    thread_local uint32_t thread_id = trace_thread_ids.fetch_add(1, std::memory_order_relaxed);
+    return thread_id;
+}
+
+int64_t genai_trace_now() {
+    return static_cast<int64_t>(timepoint_to_nanoseconds(std::chrono::steady_clock::now()));
+}
+
+void genai_trace_record(ov_genai_trace_span_e kind, uint64_t request_id, int64_t begin_ns, int64_t end_ns) {
+    if (!genai_trace_enabled())
+        return;
+    uint32_t epoch = trace_epoch.load();
+    trace_writers[epoch & 1].fetch_add(1);
+    while (trace_epoch.load() != epoch) {
+        trace_writers[epoch & 1].fetch_sub(1);
+        epoch = trace_epoch.load();
+        trace_writers[epoch & 1].fetch_add(1);
+    }
+    genai_trace_ring* ring = trace_ring.load();
+    if (ring)
+        ring->push({ static_cast<uint32_t>(kind), genai_trace_thread_id(), request_id, begin_ns, end_ns });
+    trace_writers[epoch & 1].fetch_sub(1, std::memory_order_release);
+}
+
+genai_trace_request::genai_trace_request() {
+    if (genai_trace_enabled()) {
+        id = trace_request_ids.fetch_add(1, std::memory_order_relaxed);
+        begin_ns = genai_trace_now();
+    }
+}
+
+ov::genai::StreamerVariant genai_trace_request::streamer(ov_genai_streamer_callback_t* callback) const {
+    ov_genai_streamer_callback_t function = *callback;
+    if (!active())
+        return std::function<bool(std::string)>(function);
+    uint64_t request_id = id;
+    return std::function<bool(std::string)>([function, request_id](std::string word) {
+        int64_t begin = genai_trace_now();
+        bool stop = function(std::move(word));
+        genai_trace_record(TRACE_STREAMER_CALLBACK, request_id, begin, genai_trace_now());
+        return stop;
+    });
+}
+
+ov::genai::StreamerVariant genai_trace_request::streamer(const ov_genai_streamer_t* streamer) const {
+    if (!active())
+        return streamer_to_streamer_variant(streamer);
+    ov_genai_streamer_t copy = *streamer;
+    uint64_t request_id = id;
+    return std::function<bool(std::string)>([copy, request_id](std::string word) {
+        int64_t begin = genai_trace_now();
+        bool stop = copy.callback(word.data(), word.size(), copy.user_data);
+        genai_trace_record(TRACE_STREAMER_CALLBACK, request_id, begin, genai_trace_now());
+        return stop;
+    });
+}
+
+void genai_trace_request::finish(const ov::genai::PerfMetrics* perf_metrics) const {
+    if (!active())
+        return;
+    int64_t end_ns = genai_trace_now();
+    genai_trace_record(TRACE_GENERATE, id, begin_ns, end_ns);
+    if (!perf_metrics)
+        return;
+
+    // The pipelines only report durations, so the spans are laid out around the generate call:
+    // tokenization at its begin, one decode step per new token, detokenization at its end.
+    const ov::genai::RawPerfMetrics& raw = perf_metrics->raw_metrics;
+    int64_t step_begin = begin_ns;
+    if (!raw.tokenization_durations.empty()) {
+        int64_t duration = static_cast<int64_t>(raw.tokenization_durations.back().count() * 1000.0f);
+        genai_trace_record(TRACE_TOKENIZATION, id, begin_ns, begin_ns + duration);
+        step_begin += duration;
+    }
+    for (const auto& token_time : raw.m_new_token_times) {
+        int64_t step_end = static_cast<int64_t>(timepoint_to_nanoseconds(token_time));
+        if (step_end < step_begin || step_end > end_ns)
+            continue;
+        genai_trace_record(TRACE_DECODE_STEP, id, step_begin, step_end);
+        step_begin = step_end;
+    }
+    if (!raw.detokenization_durations.empty()) {
+        int64_t duration = static_cast<int64_t>(raw.detokenization_durations.back().count() * 1000.0f);
+        genai_trace_record(TRACE_DETOKENIZATION, id, end_ns - duration, end_ns);
+    }
+}
+
+static const char* trace_span_names[] = { "generate",
+                                          "tokenization",
+                                          "decode_step",
+                                          "detokenization",
+                                          "streamer_callback",
+                                          "pipeline_step" };
+
+static std::string trace_to_chrome_json() {
+    std::vector<genai_trace_event> events;
+    {
+        std::lock_guard<std::mutex> lock(trace_mutex);
+        if (trace_ring_owner)
+            events = trace_ring_owner->snapshot();
+    }
+
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(3);
+    json << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    std::set<uint64_t> tracks;
+    bool first = true;
+    for (const auto& event : events) {
+        size_t name_index = event.kind < sizeof(trace_span_names) / sizeof(trace_span_names[0]) ? event.kind : 0;
+        json << (first ? "" : ",")
+            << "{\"name\":\"" << trace_span_names[name_index] << "\",\"cat\":\"genai\",\"ph\":\"X\""
+            << ",\"ts\":" << event.begin_ns / 1000.0
+            << ",\"dur\":" << (event.end_ns - event.begin_ns) / 1000.0
+            << ",\"pid\":1,\"tid\":" << event.request_id
+            << ",\"args\":{\"request\":" << event.request_id << ",\"thread\":" << event.thread_id << "}}";
+        first = false;
+        tracks.insert(event.request_id);
+    }
+    for (uint64_t track : tracks) {
+        json << (first ? "" : ",")
+            << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << track << ",\"args\":{\"name\":\"";
+        if (track == 0)
+            json << "pipeline";
+        else
+            json << "request " << track;
+        json << "\"}}";
+        first = false;
+    }
+    json << "]}";
+    return json.str();
+}
+
+ov_status_e ov_genai_trace_enable(size_t capacity) {
+    if (capacity == 0 || capacity > trace_max_capacity) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        size_t rounded = 1;
+        while (rounded < capacity)
+            rounded <<= 1;
+        std::lock_guard<std::mutex> lock(trace_mutex);
+        if (!trace_ring_owner || trace_ring_owner->capacity != rounded) {
+            std::unique_ptr<genai_trace_ring> replaced = std::move(trace_ring_owner);
+            trace_ring_owner.reset(new genai_trace_ring(rounded));
+            trace_ring.store(trace_ring_owner.get());
+            if (replaced) {
+                uint32_t epoch = trace_epoch.fetch_add(1);
+                while (trace_writers[epoch & 1].load(std::memory_order_acquire) != 0)
+                    std::this_thread::yield();
+            }
+        }
+        genai_trace_enabled_flag.store(true, std::memory_order_relaxed);
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+void ov_genai_trace_disable() {
+    genai_trace_enabled_flag.store(false, std::memory_order_relaxed);
+}
+
+bool ov_genai_trace_is_enabled() {
+    return genai_trace_enabled();
+}
+
+void ov_genai_trace_clear() {
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    if (trace_ring_owner)
+        trace_ring_owner->cleared.store(trace_ring_owner->head.load(std::memory_order_acquire),
+                                        std::memory_order_relaxed);
+}
+
+ov_status_e ov_genai_trace_dump_chrome_json(char** json) {
+    if (!json) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        *json = str_to_char_array(trace_to_chrome_json());
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_trace_dump_chrome_json_to_file(const char* file_path) {
+    if (!file_path) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        std::ofstream file(file_path, std::ios::out | std::ios::trunc);
+        if (!file.is_open()) {
+            dup_last_err_msg("Cannot open the trace file for writing");
+            return ov_status_e::GENERAL_ERROR;
+        }
+        file << trace_to_chrome_json();
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+        return ov_status_e::OK;
+}
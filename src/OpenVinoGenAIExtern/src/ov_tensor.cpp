@@ -10,4 +10,21 @@
 * @date 2024/7/27
 */
 
+#include "genai_common.h"
 #include "ov_tensor.h"
+
+void ov_tensor_free(ov_tensor_t* tensor) {
+    if (tensor)
+        delete tensor;
+}
+
+ov_status_e ov_tensor_get_size(const ov_tensor_t* tensor, size_t* elements_size) {
+    if (!tensor || !elements_size) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        *elements_size = tensor->object->get_size();
+    }
+    CATCH_OV_GENAI_EXCEPTIONS
+    return ov_status_e::OK;
+}
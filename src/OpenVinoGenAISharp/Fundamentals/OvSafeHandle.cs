@@ -0,0 +1,46 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace OpenVinoSharp.GenAI
+{
+    /// <summary>
+    /// Base of the handles owning one native OpenVINO GenAI object.
+    /// </summary>
+    /// <remarks>
+    /// Unlike <see cref="DisposableObject"/>, a handle carries no memory pressure and no user finalizer.
+    /// Disposing it releases the native object at once and takes it off the finalization queue, so short
+    /// lived per request objects die young. A handle that is never disposed is still released by the
+    /// critical finalizer of <see cref="SafeHandle"/>, which also guarantees that the native object is not
+    /// freed while a P/Invoke call is using it.
+    /// The handles can be returned by P/Invoke declarations directly, e.g. <c>out DecodedResultsHandle</c>,
+    /// so no wrapper object is needed around them.
+    /// </remarks>
+    public abstract class OvSafeHandle : SafeHandle
+    {
+        /// <summary>
+        /// Creates an empty handle, filled in by the P/Invoke marshaller.
+        /// </summary>
+        protected OvSafeHandle()
+            : base(IntPtr.Zero, true)
+        {
+        }
+
+        /// <summary>
+        /// Gets a value indicating whether the handle holds no native object.
+        /// </summary>
+        public override bool IsInvalid => handle == IntPtr.Zero;
+
+        /// <summary>
+        /// Takes ownership of a native pointer returned through an <c>IntPtr</c> out parameter.
+        /// </summary>
+        /// <typeparam name="THandle">The handle type matching the native object.</typeparam>
+        /// <param name="ptr">The native pointer, now owned by the returned handle.</param>
+        /// <returns>The handle.</returns>
+        public static THandle FromPointer<THandle>(IntPtr ptr) where THandle : OvSafeHandle, new()
+        {
+            var safeHandle = new THandle();
+            safeHandle.SetHandle(ptr);
+            return safeHandle;
+        }
+    }
+}
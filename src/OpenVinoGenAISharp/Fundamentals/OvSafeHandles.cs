@@ -0,0 +1,200 @@
+﻿using System;
+using OpenVinoSharp.GenAI.Internal;
+
+namespace OpenVinoSharp.GenAI
+{
+    /// <summary>
+    /// Owns a <c>ov_genai_tokenizer_t*</c>, released with <c>ov_genai_tokenizer_free</c>.
+    /// </summary>
+    public sealed class TokenizerHandle : OvSafeHandle
+    {
+        /// <inheritdoc />
+        protected override bool ReleaseHandle()
+        {
+            NativeMethods.ov_genai_tokenizer_free(handle);
+            return true;
+        }
+    }
+
+    /// <summary>
+    /// Owns a <c>ov_genai_llm_pipeline_t*</c>, released with <c>ov_genai_llm_pipeline_free</c>.
+    /// </summary>
+    public sealed class LLMPipelineHandle : OvSafeHandle
+    {
+        /// <inheritdoc />
+        protected override bool ReleaseHandle()
+        {
+            NativeMethods.ov_genai_llm_pipeline_free(handle);
+            return true;
+        }
+    }
+
+    /// <summary>
+    /// Owns a <c>ov_genai_continuous_batching_pipeline_t*</c>, released with <c>ov_genai_continuous_batching_pipeline_free</c>.
+    /// </summary>
+    public sealed class ContinuousBatchingPipelineHandle : OvSafeHandle
+    {
+        /// <inheritdoc />
+        protected override bool ReleaseHandle()
+        {
+            NativeMethods.ov_genai_continuous_batching_pipeline_free(handle);
+            return true;
+        }
+    }
+
+    /// <summary>
+    /// Owns a <c>ov_genai_generation_config_t*</c>, released with <c>ov_genai_generation_config_free</c>.
+    /// </summary>
+    public sealed class GenerationConfigHandle : OvSafeHandle
+    {
+        /// <inheritdoc />
+        protected override bool ReleaseHandle()
+        {
+            NativeMethods.ov_genai_generation_config_free(handle);
+            return true;
+        }
+    }
+
+    /// <summary>
+    /// Owns a <c>ov_genai_decoded_results_t*</c>, released with <c>ov_genai_decoded_results_free</c>.
+    /// </summary>
+    public sealed class DecodedResultsHandle : OvSafeHandle
+    {
+        /// <inheritdoc />
+        protected override bool ReleaseHandle()
+        {
+            NativeMethods.ov_genai_decoded_results_free(handle);
+            return true;
+        }
+    }
+
+    /// <summary>
+    /// Owns a <c>ov_genai_encoded_results_t*</c>, released with <c>ov_genai_encoded_results_free</c>.
+    /// </summary>
+    public sealed class EncodedResultsHandle : OvSafeHandle
+    {
+        /// <inheritdoc />
+        protected override bool ReleaseHandle()
+        {
+            NativeMethods.ov_genai_encoded_results_free(handle);
+            return true;
+        }
+    }
+
+    /// <summary>
+    /// Owns a <c>ov_genai_perf_metrics_t*</c>, released with <c>ov_genai_perf_metrics_free</c>.
+    /// </summary>
+    public sealed class PerfMetricsHandle : OvSafeHandle
+    {
+        /// <inheritdoc />
+        protected override bool ReleaseHandle()
+        {
+            NativeMethods.ov_genai_perf_metrics_free(handle);
+            return true;
+        }
+    }
+
+    /// <summary>
+    /// Owns a <c>ov_genai_raw_perf_metrics_t*</c>, released with <c>ov_genai_raw_perf_metrics_free</c>.
+    /// </summary>
+    public sealed class RawPerfMetricsHandle : OvSafeHandle
+    {
+        /// <inheritdoc />
+        protected override bool ReleaseHandle()
+        {
+            NativeMethods.ov_genai_raw_perf_metrics_free(handle);
+            return true;
+        }
+    }
+
+    /// <summary>
+    /// Owns a <c>ov_genai_tokenized_inputs_t*</c>, released with <c>ov_genai_tokenized_inputs_free</c>.
+    /// </summary>
+    public sealed class TokenizedInputsHandle : OvSafeHandle
+    {
+        /// <inheritdoc />
+        protected override bool ReleaseHandle()
+        {
+            NativeMethods.ov_genai_tokenized_inputs_free(handle);
+            return true;
+        }
+    }
+
+    /// <summary>
+    /// Owns a <c>ov_genai_generation_handle_t*</c>, released with <c>ov_genai_generation_handle_free</c>.
+    /// </summary>
+    public sealed class GenerationHandleSafeHandle : OvSafeHandle
+    {
+        /// <inheritdoc />
+        protected override bool ReleaseHandle()
+        {
+            NativeMethods.ov_genai_generation_handle_free(handle);
+            return true;
+        }
+    }
+
+    /// <summary>
+    /// Owns a <c>ov_genai_generation_outputs_t*</c>, released with <c>ov_genai_generation_outputs_free</c>.
+    /// </summary>
+    public sealed class GenerationOutputsHandle : OvSafeHandle
+    {
+        /// <inheritdoc />
+        protected override bool ReleaseHandle()
+        {
+            NativeMethods.ov_genai_generation_outputs_free(handle);
+            return true;
+        }
+    }
+
+    /// <summary>
+    /// Owns a <c>ov_genai_generation_output_t*</c>, released with <c>ov_genai_generation_output_free</c>.
+    /// </summary>
+    public sealed class GenerationOutputHandle : OvSafeHandle
+    {
+        /// <inheritdoc />
+        protected override bool ReleaseHandle()
+        {
+            NativeMethods.ov_genai_generation_output_free(handle);
+            return true;
+        }
+    }
+
+    /// <summary>
+    /// Owns a <c>ov_genai_generation_result_t*</c>, released with <c>ov_genai_generation_result_free</c>.
+    /// </summary>
+    public sealed class GenerationResultHandle : OvSafeHandle
+    {
+        /// <inheritdoc />
+        protected override bool ReleaseHandle()
+        {
+            NativeMethods.ov_genai_generation_result_free(handle);
+            return true;
+        }
+    }
+
+    /// <summary>
+    /// Owns a <c>ov_genai_encoded_generation_result_t*</c>, released with <c>ov_genai_encoded_generation_result_free</c>.
+    /// </summary>
+    public sealed class EncodedGenerationResultHandle : OvSafeHandle
+    {
+        /// <inheritdoc />
+        protected override bool ReleaseHandle()
+        {
+            NativeMethods.ov_genai_encoded_generation_result_free(handle);
+            return true;
+        }
+    }
+
+    /// <summary>
+    /// Owns a <c>ov_genai_cancellation_token_t*</c>, released with <c>ov_genai_cancellation_token_free</c>.
+    /// </summary>
+    public sealed class CancellationTokenHandle : OvSafeHandle
+    {
+        /// <inheritdoc />
+        protected override bool ReleaseHandle()
+        {
+            NativeMethods.ov_genai_cancellation_token_free(handle);
+            return true;
+        }
+    }
+}
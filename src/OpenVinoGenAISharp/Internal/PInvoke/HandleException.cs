@@ -97,13 +97,31 @@ namespace OpenVinoSharp.GenAI.Internal
             }
 
         }
+        /// <summary>
+        /// Reads the last error of the calling thread in place, the native side keeps the message.
+        /// </summary>
+        /// <returns>The message, empty when there is none.</returns>
+        private static unsafe string lastErrMsg()
+        {
+#if NET7_0_OR_GREATER
+            return BlittableNativeMethods.GetLastErrorMessage() ?? string.Empty;
+#else
+            if (NativeMethods.ov_genai_get_last_err_msg_view(out _, out IntPtr msg, out UIntPtr length) != ExceptionStatus.OK
+                || msg == IntPtr.Zero)
+            {
+                return string.Empty;
+            }
+            return Encoding.UTF8.GetString((byte*)msg, checked((int)length.ToUInt64()));
+#endif
+        }
+
         /// <summary>
         /// Throw GENERAL_ERROR OpenVINOException.
         /// </summary>
         /// <exception cref="OVException">general error!</exception>
         private static void generalError()
         {
-            throw new OVException(ExceptionStatus.GENERAL_ERROR, Marshal.PtrToStringAnsi(NativeMethods.ov_genai_get_last_err_msg()));
+            throw new OVException(ExceptionStatus.GENERAL_ERROR, lastErrMsg());
         }
         /// <summary>
         /// Throw NOT_IMPLEMENTED OpenVINOException.
@@ -111,7 +129,7 @@ namespace OpenVinoSharp.GenAI.Internal
         /// <exception cref="OVException">not implemented!</exception>
         private static void notImplemented()
         {
-            throw new OVException(ExceptionStatus.NOT_IMPLEMENTED, Marshal.PtrToStringAnsi(NativeMethods.ov_genai_get_last_err_msg()));
+            throw new OVException(ExceptionStatus.NOT_IMPLEMENTED, lastErrMsg());
         }
 
         /// <summary>
@@ -120,7 +138,7 @@ namespace OpenVinoSharp.GenAI.Internal
         /// <exception cref="OVException">network not loaded!</exception>
         private static void networkNotLoaded()
         {
-            throw new OVException(ExceptionStatus.NETWORK_NOT_LOADED, Marshal.PtrToStringAnsi(NativeMethods.ov_genai_get_last_err_msg()));
+            throw new OVException(ExceptionStatus.NETWORK_NOT_LOADED, lastErrMsg());
         }
 
 
@@ -130,7 +148,7 @@ namespace OpenVinoSharp.GenAI.Internal
         /// <exception cref="OVException">parameter mismatch!</exception>
         private static void parameterMismatch()
         {
-            throw new OVException(ExceptionStatus.PARAMETER_MISMATCH, Marshal.PtrToStringAnsi(NativeMethods.ov_genai_get_last_err_msg()));
+            throw new OVException(ExceptionStatus.PARAMETER_MISMATCH, lastErrMsg());
         }
 
         /// <summary>
@@ -139,7 +157,7 @@ namespace OpenVinoSharp.GenAI.Internal
         /// <exception cref="OVException">not found!</exception>
         private static void notFound()
         {
-            throw new OVException(ExceptionStatus.NOT_FOUND, Marshal.PtrToStringAnsi(NativeMethods.ov_genai_get_last_err_msg()));
+            throw new OVException(ExceptionStatus.NOT_FOUND, lastErrMsg());
         }
 
         /// <summary>
@@ -148,7 +166,7 @@ namespace OpenVinoSharp.GenAI.Internal
         /// <exception cref="OVException">out of bounds!</exception>
         private static void outOfBounds()
         {
-            throw new OVException(ExceptionStatus.OUT_OF_BOUNDS, Marshal.PtrToStringAnsi(NativeMethods.ov_genai_get_last_err_msg()));
+            throw new OVException(ExceptionStatus.OUT_OF_BOUNDS, lastErrMsg());
         }
 
 
@@ -158,7 +176,7 @@ namespace OpenVinoSharp.GenAI.Internal
         /// <exception cref="OVException">unexpection!</exception>
         private static void unExpection()
         {
-            throw new OVException(ExceptionStatus.UNEXPECTED, Marshal.PtrToStringAnsi(NativeMethods.ov_genai_get_last_err_msg()));
+            throw new OVException(ExceptionStatus.UNEXPECTED, lastErrMsg());
         }
 
 
@@ -169,7 +187,7 @@ namespace OpenVinoSharp.GenAI.Internal
         /// <exception cref="OVException">request busy!</exception>
         private static void requestBusy()
         {
-            throw new OVException(ExceptionStatus.REQUEST_BUSY, Marshal.PtrToStringAnsi(NativeMethods.ov_genai_get_last_err_msg()));
+            throw new OVException(ExceptionStatus.REQUEST_BUSY, lastErrMsg());
         }
         /// <summary>
         /// Throw RESULT_NOT_READY OpenVINOException.
@@ -177,7 +195,7 @@ namespace OpenVinoSharp.GenAI.Internal
         /// <exception cref="OVException">result not ready!</exception>
         private static void resultNotReady()
         {
-            throw new OVException(ExceptionStatus.RESULT_NOT_READY, Marshal.PtrToStringAnsi(NativeMethods.ov_genai_get_last_err_msg()));
+            throw new OVException(ExceptionStatus.RESULT_NOT_READY, lastErrMsg());
         }
         /// <summary>
         /// Throw OpenVINOException.
@@ -185,7 +203,7 @@ namespace OpenVinoSharp.GenAI.Internal
         /// <exception cref="OVException">not allocated!</exception>
         private static void notAllocated()
         {
-            throw new OVException(ExceptionStatus.NOT_ALLOCATED, Marshal.PtrToStringAnsi(NativeMethods.ov_genai_get_last_err_msg()));
+            throw new OVException(ExceptionStatus.NOT_ALLOCATED, lastErrMsg());
         }
         /// <summary>
         /// Throw INFER_NOT_STARTED OpenVINOException.
@@ -193,7 +211,7 @@ namespace OpenVinoSharp.GenAI.Internal
         /// <exception cref="OVException">infer not started!</exception>
         private static void inferNotStarted()
         {
-            throw new OVException(ExceptionStatus.INFER_NOT_STARTED, Marshal.PtrToStringAnsi(NativeMethods.ov_genai_get_last_err_msg()));
+            throw new OVException(ExceptionStatus.INFER_NOT_STARTED, lastErrMsg());
         }
         /// <summary>
         /// Throw NETWORK_NOT_READ OpenVINOException.
@@ -201,7 +219,7 @@ namespace OpenVinoSharp.GenAI.Internal
         /// <exception cref="OVException">netword not read!</exception>
         private static void networdNotRead()
         {
-            throw new OVException(ExceptionStatus.NETWORK_NOT_READ, Marshal.PtrToStringAnsi(NativeMethods.ov_genai_get_last_err_msg()));
+            throw new OVException(ExceptionStatus.NETWORK_NOT_READ, lastErrMsg());
         }
         /// <summary>
         /// Throw INFER_CANCELLED OpenVINOException.
@@ -209,7 +227,7 @@ namespace OpenVinoSharp.GenAI.Internal
         /// <exception cref="OVException">infer cancelled!</exception>
         private static void inferCancelled()
         {
-            throw new OVException(ExceptionStatus.INFER_CANCELLED, Marshal.PtrToStringAnsi(NativeMethods.ov_genai_get_last_err_msg()));
+            throw new OVException(ExceptionStatus.INFER_CANCELLED, lastErrMsg());
         }
         /// <summary>
         /// Throw INVALID_C_PARAM OpenVINOException.
@@ -217,7 +235,7 @@ namespace OpenVinoSharp.GenAI.Internal
         /// <exception cref="OVException">invalid c param!</exception>
         private static void invalid_c_param()
         {
-            throw new OVException(ExceptionStatus.INVALID_C_PARAM, Marshal.PtrToStringAnsi(NativeMethods.ov_genai_get_last_err_msg()));
+            throw new OVException(ExceptionStatus.INVALID_C_PARAM, lastErrMsg());
         }
         /// <summary>
         /// Throw UNKNOWN_C_ERROR OpenVINOException.
@@ -225,7 +243,7 @@ namespace OpenVinoSharp.GenAI.Internal
         /// <exception cref="OVException">unknown c error!</exception>
         private static void unknownCError()
         {
-            throw new OVException(ExceptionStatus.UNKNOWN_C_ERROR, Marshal.PtrToStringAnsi(NativeMethods.ov_genai_get_last_err_msg()));
+            throw new OVException(ExceptionStatus.UNKNOWN_C_ERROR, lastErrMsg());
         }
         /// <summary>
         /// Throw NOT_IMPLEMENT_C_METHOD OpenVINOException.
@@ -233,7 +251,7 @@ namespace OpenVinoSharp.GenAI.Internal
         /// <exception cref="OVException">not implement c method!</exception>
         private static void notImplementCMethod()
         {
-            throw new OVException(ExceptionStatus.NOT_IMPLEMENT_C_METHOD, Marshal.PtrToStringAnsi(NativeMethods.ov_genai_get_last_err_msg()));
+            throw new OVException(ExceptionStatus.NOT_IMPLEMENT_C_METHOD, lastErrMsg());
         }
         /// <summary>
         /// Throw UNKNOW_EXCEPTION OpenVINOException.
@@ -241,7 +259,7 @@ namespace OpenVinoSharp.GenAI.Internal
         /// <exception cref="OVException">unknown exception!</exception>
         private static void unknownException()
         {
-            throw new OVException(ExceptionStatus.UNKNOW_EXCEPTION, Marshal.PtrToStringAnsi(NativeMethods.ov_genai_get_last_err_msg()));
+            throw new OVException(ExceptionStatus.UNKNOW_EXCEPTION, lastErrMsg());
         }
         /// <summary>
         /// Throw PTR_NULL OpenVINOException.
@@ -249,7 +267,7 @@ namespace OpenVinoSharp.GenAI.Internal
         /// <exception cref="OVException"></exception>
         private static void ptrNullException()
         {
-            throw new OVException(ExceptionStatus.UNKNOW_EXCEPTION, Marshal.PtrToStringAnsi(NativeMethods.ov_genai_get_last_err_msg()));
+            throw new OVException(ExceptionStatus.UNKNOW_EXCEPTION, lastErrMsg());
         }
     }
 }
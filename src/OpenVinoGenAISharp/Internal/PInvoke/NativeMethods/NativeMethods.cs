@@ -91,6 +91,9 @@ namespace OpenVinoSharp.GenAI.Internal
 
             if (IsUnix())
             {
+#if NETCOREAPP3_0_OR_GREATER
+                UnixLibraryLoader.Register(additionalPaths);
+#endif
 #if DOTNETCORE
             ExceptionHandler.RegisterExceptionCallback();
 #endif
@@ -164,6 +167,9 @@ namespace OpenVinoSharp.GenAI.Internal
         {
 #if NET48
             return !IsUnix();
+#elif NET5_0_OR_GREATER
+            // a JIT and AOT time constant, so the _Windows/_NotWindows dispatch folds away
+            return OperatingSystem.IsWindows();
 #else
             return RuntimeInformation.IsOSPlatform(OSPlatform.Windows);
 #endif
@@ -196,9 +202,13 @@ namespace OpenVinoSharp.GenAI.Internal
         /// <returns></returns>
         public static bool IsMono()
         {
-            return (Type.GetType("Mono.Runtime") is not null);
+            return isMono;
         }
 
+        // FrameworkDescription instead of Type.GetType("Mono.Runtime"), which the trimmer cannot follow
+        private static readonly bool isMono =
+            RuntimeInformation.FrameworkDescription.StartsWith("Mono", StringComparison.Ordinal);
+
         /// <summary>
         /// Returns whether the architecture is Wasm or not
         /// </summary>
@@ -0,0 +1,181 @@
+﻿#if NET7_0_OR_GREATER
+#nullable enable
+using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace OpenVinoSharp.GenAI.Internal
+{
+    /// <summary>
+    /// Source-generated P/Invoke declarations for .NET 7 and later, used by the calls made per generation or per
+    /// step on those targets. Strings are <c>byte*</c> encoded by the caller, see <see cref="Utf8StringMarshaller"/>,
+    /// and out parameters are blittable. The only marshalling the generator emits is the reference counting of the
+    /// SafeHandle parameters, so the calls work under Native AOT and trimming.
+    /// </summary>
+    public static unsafe partial class BlittableNativeMethods
+    {
+        private const string dllExtern = "openvino_genai_c";
+
+        /// <summary>
+        /// Makes sure the native library is located before the first call, see <see cref="NativeMethods.LoadLibraries"/>.
+        /// </summary>
+        static BlittableNativeMethods()
+        {
+            NativeMethods.TryPInvoke();
+        }
+
+        [LibraryImport(dllExtern, EntryPoint = "ov_genai_llm_sizeof")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ExceptionStatus ov_genai_llm_sizeof();
+
+        /// <summary>
+        /// Print the error info.
+        /// </summary>
+        /// <param name="status">a status code.</param>
+        /// <returns>A static null-terminated string, do not free it.</returns>
+        [LibraryImport(dllExtern, EntryPoint = "ov_genai_get_error_info")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial byte* ov_genai_get_error_info(ExceptionStatus status);
+
+        /// <summary>
+        /// Get the last error msg.
+        /// </summary>
+        /// <returns>A copy of the message, free it with <see cref="ov_genai_free"/>, or null.</returns>
+        [LibraryImport(dllExtern, EntryPoint = "ov_genai_get_last_err_msg")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial byte* ov_genai_get_last_err_msg();
+
+        /// <summary>
+        /// Get the last error of the calling thread without copying it.
+        /// </summary>
+        /// <returns>Status code of the operation, the message stays owned by the library.</returns>
+        [LibraryImport(dllExtern, EntryPoint = "ov_genai_get_last_err_msg_view")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ExceptionStatus ov_genai_get_last_err_msg_view(ExceptionStatus* status, byte** msg,
+            nuint* length);
+
+        /// <summary>
+        /// free char
+        /// </summary>
+        /// <param name="content">The pointer to the char to free.</param>
+        [LibraryImport(dllExtern, EntryPoint = "ov_genai_free")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void ov_genai_free(byte* content);
+
+        [LibraryImport(dllExtern, EntryPoint = "ov_genai_tokenizer_create")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ExceptionStatus ov_genai_tokenizer_create(nint* tokenizer);
+
+        [LibraryImport(dllExtern, EntryPoint = "ov_genai_tokenizer_create_with_path")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ExceptionStatus ov_genai_tokenizer_create_with_path(byte* tokenizerPath, nint* tokenizer);
+
+        [LibraryImport(dllExtern, EntryPoint = "ov_genai_tokenizer_free")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void ov_genai_tokenizer_free(nint tokenizer);
+
+        [LibraryImport(dllExtern, EntryPoint = "ov_genai_tokenizer_encode_strings")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ExceptionStatus ov_genai_tokenizer_encode_strings(
+            nint tokenizer,
+            StringArray prompt,
+            nint* tokenizedInputs);
+
+        [LibraryImport(dllExtern, EntryPoint = "ov_genai_llm_pipeline_generate_string")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        private static partial ExceptionStatus ov_genai_llm_pipeline_generate_string(
+            LLMPipelineHandle llmPipeline,
+            byte* inputs,
+            out DecodedResultsHandle decodedResults);
+
+        [LibraryImport(dllExtern, EntryPoint = "ov_genai_llm_pipeline_generate_string_with_config")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        private static partial ExceptionStatus ov_genai_llm_pipeline_generate_string_with_config(
+            LLMPipelineHandle llmPipeline,
+            byte* inputs,
+            GenerationConfigHandle generationConfig,
+            out DecodedResultsHandle decodedResults);
+
+        /// <summary>
+        /// Gets the texts of the results as one string, free it with <see cref="ov_genai_free"/>.
+        /// </summary>
+        [LibraryImport(dllExtern, EntryPoint = "ov_genai_decoded_results_get_texts")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ExceptionStatus ov_genai_decoded_results_get_texts(
+            DecodedResultsHandle decodedResults,
+            out nint texts);
+
+        /// <summary>
+        /// Runs one step when a request is left to run, <see cref="TryStatus.IDLE"/> otherwise.
+        /// </summary>
+        [LibraryImport(dllExtern, EntryPoint = "ov_genai_continuous_batching_pipeline_try_step")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ExceptionStatus ov_genai_continuous_batching_pipeline_try_step(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            out TryStatus result);
+
+        /// <summary>
+        /// Passes the new text of a request to its streamer.
+        /// </summary>
+        [LibraryImport(dllExtern, EntryPoint = "ov_genai_generation_handle_stream")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ExceptionStatus ov_genai_generation_handle_stream(
+            GenerationHandleSafeHandle generationHandle,
+            out int finished);
+
+        /// <summary>
+        /// Generates the answer of a NUL-terminated UTF-8 prompt.
+        /// </summary>
+        public static ExceptionStatus ov_genai_llm_pipeline_generate_string(LLMPipelineHandle llmPipeline, byte[] inputs,
+            out DecodedResultsHandle decodedResults)
+        {
+            fixed (byte* p = inputs)
+            {
+                return ov_genai_llm_pipeline_generate_string(llmPipeline, p, out decodedResults);
+            }
+        }
+
+        /// <summary>
+        /// Generates the answer of a NUL-terminated UTF-8 prompt with a generation config.
+        /// </summary>
+        public static ExceptionStatus ov_genai_llm_pipeline_generate_string_with_config(LLMPipelineHandle llmPipeline,
+            byte[] inputs, GenerationConfigHandle generationConfig, out DecodedResultsHandle decodedResults)
+        {
+            fixed (byte* p = inputs)
+            {
+                return ov_genai_llm_pipeline_generate_string_with_config(llmPipeline, p, generationConfig,
+                    out decodedResults);
+            }
+        }
+
+        /// <summary>
+        /// Creates a tokenizer from a path, encoding it to UTF-8 on the stack.
+        /// </summary>
+        public static ExceptionStatus ov_genai_tokenizer_create_with_path(ReadOnlySpan<char> tokenizerPath, out nint tokenizer)
+        {
+            using var path = new Utf8StringMarshaller(tokenizerPath, stackalloc byte[Utf8StringMarshaller.StackBufferSize]);
+            nint result = 0;
+            ExceptionStatus status;
+            fixed (byte* p = path)
+            {
+                status = ov_genai_tokenizer_create_with_path(p, &result);
+            }
+            tokenizer = result;
+            return status;
+        }
+
+        /// <summary>
+        /// Reads the last error message of the calling thread, or returns null when there is none.
+        /// </summary>
+        public static string? GetLastErrorMessage()
+        {
+            byte* message = null;
+            nuint length = 0;
+            if (ov_genai_get_last_err_msg_view(null, &message, &length) != ExceptionStatus.OK || message == null
+                || length == 0)
+                return null;
+            return System.Text.Encoding.UTF8.GetString(message, checked((int)length));
+        }
+    }
+}
+#endif
@@ -0,0 +1,51 @@
+﻿using System;
+using System.Runtime.InteropServices;
+using System.Diagnostics.Contracts;
+
+namespace OpenVinoSharp.GenAI.Internal
+{
+    public static partial class NativeMethods
+    {
+        /// <summary>
+        /// Constructs a cancellation token which is not cancelled.
+        /// </summary>
+        /// <param name="cancellationToken">The created token.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_cancellation_token_create")]
+        public extern static ExceptionStatus ov_genai_cancellation_token_create(
+            out CancellationTokenHandle cancellationToken);
+
+        /// <summary>
+        /// Cancels the token. The generations it is attached to stop before their next token.
+        /// </summary>
+        /// <param name="cancellationToken">The token.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_cancellation_token_cancel")]
+        public extern static ExceptionStatus ov_genai_cancellation_token_cancel(
+            CancellationTokenHandle cancellationToken);
+
+        /// <summary>
+        /// Clears the token so it can be used for the next generation.
+        /// </summary>
+        /// <param name="cancellationToken">The token.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_cancellation_token_reset")]
+        public extern static ExceptionStatus ov_genai_cancellation_token_reset(
+            CancellationTokenHandle cancellationToken);
+
+        /// <summary>
+        /// Gets whether the token is cancelled.
+        /// </summary>
+        /// <param name="cancellationToken">The token.</param>
+        /// <param name="cancelled">Set to true when the token is cancelled.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_cancellation_token_is_cancelled")]
+        public extern static ExceptionStatus ov_genai_cancellation_token_is_cancelled(
+            CancellationTokenHandle cancellationToken,
+            [MarshalAs(UnmanagedType.U1)] out bool cancelled);
+    }
+}
\ No newline at end of file
@@ -24,6 +24,14 @@ namespace OpenVinoSharp.GenAI.Internal
             CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         public extern static void ov_genai_free(ref char content);
 
+        /// <summary>
+        /// free a string returned by the native library
+        /// </summary>
+        /// <param name="content">The string to free.</param>
+        [Pure, DllImport(dllExtern, EntryPoint = "ov_genai_free",
+            CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public extern static void ov_genai_free(IntPtr content);
+
 
         /// <summary>
         /// Get the last error msg.
@@ -32,5 +40,17 @@ namespace OpenVinoSharp.GenAI.Internal
         [Pure, DllImport(dllExtern, EntryPoint = "ov_genai_get_last_err_msg",
             CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         public extern static IntPtr ov_genai_get_last_err_msg();
+
+        /// <summary>
+        /// Get the last error of the calling thread without copying it.
+        /// </summary>
+        /// <param name="status">The status code the failing call returned.</param>
+        /// <param name="msg">The message, valid until the next failing call on the thread.</param>
+        /// <param name="length">The length of the message in bytes.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, EntryPoint = "ov_genai_get_last_err_msg_view",
+            CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public extern static ExceptionStatus ov_genai_get_last_err_msg_view(out ExceptionStatus status,
+            out IntPtr msg, out UIntPtr length);
     }
 }
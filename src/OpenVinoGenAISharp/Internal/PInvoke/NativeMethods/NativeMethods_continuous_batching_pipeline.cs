@@ -0,0 +1,537 @@
+﻿using System;
+using System.Runtime.InteropServices;
+using System.Diagnostics.Contracts;
+
+namespace OpenVinoSharp.GenAI.Internal
+{
+    public static partial class NativeMethods
+    {
+        /// <summary>
+        /// Creates a continuous batching pipeline from a model directory, a scheduler config and a device.
+        /// The strings are marshalled for platforms other than Windows.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The created pipeline.</param>
+        /// <param name="modelPath">The model directory.</param>
+        /// <param name="schedulerConfig">The scheduler config.</param>
+        /// <param name="deviceName">The device to run the model on.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_create_with_scheduler_device")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_create_with_scheduler_device_NotWindows(
+            out ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            [MarshalAs(StringUnmanagedTypeNotWindows)] string modelPath,
+            [In] ref SchedulerConfig schedulerConfig,
+            [MarshalAs(StringUnmanagedTypeNotWindows)] string deviceName);
+
+        /// <summary>
+        /// Creates a continuous batching pipeline from a model directory, a scheduler config and a device.
+        /// The strings are marshalled for Windows.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The created pipeline.</param>
+        /// <param name="modelPath">The model directory.</param>
+        /// <param name="schedulerConfig">The scheduler config.</param>
+        /// <param name="deviceName">The device to run the model on.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_create_with_scheduler_device")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_create_with_scheduler_device_Windows(
+            out ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            [MarshalAs(StringUnmanagedTypeWindows)] string modelPath,
+            [In] ref SchedulerConfig schedulerConfig,
+            [MarshalAs(StringUnmanagedTypeWindows)] string deviceName);
+
+        /// <summary>
+        /// Creates a continuous batching pipeline from a model directory, a scheduler config and a device.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The created pipeline.</param>
+        /// <param name="modelPath">The model directory.</param>
+        /// <param name="schedulerConfig">The scheduler config.</param>
+        /// <param name="deviceName">The device to run the model on.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure]
+        public static ExceptionStatus ov_genai_continuous_batching_pipeline_create_with_scheduler_device(
+            out ContinuousBatchingPipelineHandle continuousBatchingPipeline, string modelPath,
+            ref SchedulerConfig schedulerConfig, string deviceName)
+        {
+            if (IsWindows())
+                return ov_genai_continuous_batching_pipeline_create_with_scheduler_device_Windows(
+                    out continuousBatchingPipeline, modelPath, ref schedulerConfig, deviceName);
+            return ov_genai_continuous_batching_pipeline_create_with_scheduler_device_NotWindows(
+                out continuousBatchingPipeline, modelPath, ref schedulerConfig, deviceName);
+        }
+
+        /// <summary>
+        /// Gets the default generation config of the pipeline.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="generationConfig">The default generation config.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_get_config")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_get_config(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            out GenerationConfigHandle generationConfig);
+
+        /// <summary>
+        /// Adds a request streaming its text to a streamer.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="requestId">The id of the request.</param>
+        /// <param name="prompt">The prompt, UTF-8 with a terminating zero.</param>
+        /// <param name="samplingParams">The generation config of the request.</param>
+        /// <param name="streamer">The streamer of the generated text.</param>
+        /// <param name="generationHandle">The handle of the added request.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_add_request_with_prompt_and_streamer")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_add_request_with_prompt_and_streamer(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            ulong requestId,
+            [In] byte[] prompt,
+            GenerationConfigHandle samplingParams,
+            [In] ref Streamer streamer,
+            out GenerationHandleSafeHandle generationHandle);
+
+        /// <summary>
+        /// Runs one step of the pipeline over its requests.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_step")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_step(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline);
+
+        /// <summary>
+        /// Gets whether a request of the pipeline has not finished.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="flag">1 while a request has not finished, otherwise 0.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_has_non_finished_requests")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_has_non_finished_requests(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            out int flag);
+
+        /// <summary>
+        /// Adds a request, or reports through the result that the pipeline holds the maximum number of requests.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="requestId">The id of the request.</param>
+        /// <param name="prompt">The prompt, UTF-8 with a terminating zero.</param>
+        /// <param name="samplingParams">The generation config of the request.</param>
+        /// <param name="streamer">The streamer of the generated text.</param>
+        /// <param name="maxRequests">The number of requests at which the pipeline is full, 0 for no limit.</param>
+        /// <param name="generationHandle">The handle of the added request.</param>
+        /// <param name="result">TRY_OK when the request was added, TRY_QUEUE_FULL when the pipeline is full.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_try_add_request")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_try_add_request(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            ulong requestId,
+            [In] byte[] prompt,
+            GenerationConfigHandle samplingParams,
+            [In] ref Streamer streamer,
+            UIntPtr maxRequests,
+            out GenerationHandleSafeHandle generationHandle,
+            out TryStatus result);
+
+        /// <summary>
+        /// Runs one step when a request is left to run.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="result">TRY_OK after a step, TRY_IDLE when no request was left to run.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_try_step")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_try_step(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            out TryStatus result);
+
+        /// <summary>
+        /// Sets the limits of the admission control.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="admissionConfig">The limits of the admission control.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_set_admission_config")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_set_admission_config(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            [In] ref AdmissionConfig admissionConfig);
+
+        /// <summary>
+        /// Removes the admission control, given IntPtr.Zero.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="admissionConfig">IntPtr.Zero.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_set_admission_config")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_set_admission_config(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            IntPtr admissionConfig);
+
+        /// <summary>
+        /// Gets the load seen by the admission control.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="admissionState">The load seen by the admission control.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_get_admission_state")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_get_admission_state(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            out AdmissionState admissionState);
+
+        /// <summary>
+        /// Sets the limits of the request scheduler.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="schedulerConfig">The limits of the request scheduler.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_set_request_scheduler_config")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_set_request_scheduler_config(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            [In] ref RequestSchedulerConfig schedulerConfig);
+
+        /// <summary>
+        /// Adds a request to the request scheduler with its priority, deadline and tenant.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="requestId">The id of the request.</param>
+        /// <param name="prompt">The prompt, UTF-8 with a terminating zero.</param>
+        /// <param name="samplingParams">The generation config of the request.</param>
+        /// <param name="streamer">The streamer of the generated text.</param>
+        /// <param name="options">The priority, deadline and tenant of the request.</param>
+        /// <param name="generationHandle">The handle of the added request.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_add_request_with_options")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_add_request_with_options(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            ulong requestId,
+            [In] byte[] prompt,
+            GenerationConfigHandle samplingParams,
+            [In] ref Streamer streamer,
+            [In] ref RequestOptions options,
+            out GenerationHandleSafeHandle generationHandle);
+
+        /// <summary>
+        /// Sets the weight of a tenant of the request scheduler.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="tenant">The tenant, UTF-8 with a terminating zero, null for the default tenant.</param>
+        /// <param name="weight">The weight, greater than 0.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_set_tenant_weight")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_set_tenant_weight(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            [In] byte[] tenant,
+            float weight);
+
+        /// <summary>
+        /// Gets the counters of a tenant of the request scheduler.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="tenant">The tenant, UTF-8 with a terminating zero, null for the default tenant.</param>
+        /// <param name="tenantMetrics">The counters of the tenant.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_get_tenant_metrics")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_get_tenant_metrics(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            [In] byte[] tenant,
+            out TenantMetrics tenantMetrics);
+
+        /// <summary>
+        /// Turns the coalescing of identical greedy requests in flight on or off.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="enable">Non-zero to coalesce the requests added from now on.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_set_request_coalescing")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_set_request_coalescing(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            int enable);
+
+        /// <summary>
+        /// Gets the number of requests served by joining an identical one.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="coalescedRequests">The number of requests.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_get_coalesced_requests")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_get_coalesced_requests(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            out ulong coalescedRequests);
+
+        /// <summary>
+        /// Sets the completion cache replaying greedy generations.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="cacheConfig">The completion cache config.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_set_completion_cache")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_set_completion_cache(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            [In] ref CompletionCacheConfig cacheConfig);
+
+        /// <summary>
+        /// Removes the completion cache, given IntPtr.Zero.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="cacheConfig">IntPtr.Zero.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_set_completion_cache")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_set_completion_cache(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            IntPtr cacheConfig);
+
+        /// <summary>
+        /// Gets the counters of the completion cache.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="cacheStats">The counters of the cache.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_get_completion_cache_stats")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_get_completion_cache_stats(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            out CompletionCacheStats cacheStats);
+
+        /// <summary>
+        /// Keeps the tokens of a prompt prefix in a snapshot file, under a model id.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="path">The snapshot file, UTF-8 with a terminating zero.</param>
+        /// <param name="modelId">The model the prefixes are kept for, UTF-8 with a terminating zero.</param>
+        /// <param name="prefix">The prompt prefix, UTF-8 with a terminating zero.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_save_prefix_snapshot")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_save_prefix_snapshot(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            [In] byte[] path,
+            [In] byte[] modelId,
+            [In] byte[] prefix);
+
+        /// <summary>
+        /// Prefills the prefixes a snapshot file keeps for a model.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="path">The snapshot file, UTF-8 with a terminating zero.</param>
+        /// <param name="modelId">The model the prefixes are kept for, UTF-8 with a terminating zero.</param>
+        /// <param name="restored">The number of prefixes prefilled.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_restore_prefix_snapshots")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_restore_prefix_snapshots(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            [In] byte[] path,
+            [In] byte[] modelId,
+            out UIntPtr restored);
+
+        /// <summary>
+        /// Adds a request continuing a chat session, or reports through the result that the pipeline is full.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="requestId">The id of the request.</param>
+        /// <param name="sessionId">The id of the session, UTF-8 with a terminating zero.</param>
+        /// <param name="prompt">The prompt, UTF-8 with a terminating zero.</param>
+        /// <param name="samplingParams">The generation config of the request.</param>
+        /// <param name="streamer">The streamer of the generated text.</param>
+        /// <param name="maxRequests">The number of requests at which the pipeline is full, 0 for no limit.</param>
+        /// <param name="generationHandle">The handle of the added request.</param>
+        /// <param name="result">TRY_OK when the request was added, TRY_QUEUE_FULL when the pipeline is full.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_try_add_session_request")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_try_add_session_request(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            ulong requestId,
+            [In] byte[] sessionId,
+            [In] byte[] prompt,
+            GenerationConfigHandle samplingParams,
+            [In] ref Streamer streamer,
+            UIntPtr maxRequests,
+            out GenerationHandleSafeHandle generationHandle,
+            out TryStatus result);
+
+        /// <summary>
+        /// Sets the bounds of the chat sessions.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="sessionsConfig">The bounds of the chat sessions.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_set_chat_sessions")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_set_chat_sessions(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            [In] ref ChatSessionsConfig sessionsConfig);
+
+        /// <summary>
+        /// Removes the bounds of the chat sessions, given IntPtr.Zero.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="sessionsConfig">IntPtr.Zero.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_set_chat_sessions")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_set_chat_sessions(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            IntPtr sessionsConfig);
+
+        /// <summary>
+        /// Ends a chat session and drops its history.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="sessionId">The id of the session, UTF-8 with a terminating zero.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_end_session")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_end_session(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            [In] byte[] sessionId);
+
+        /// <summary>
+        /// Gets the counters of the chat sessions.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The pipeline.</param>
+        /// <param name="sessionsStats">The counters of the chat sessions.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_get_chat_sessions_stats")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_get_chat_sessions_stats(
+            ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            out ChatSessionsStats sessionsStats);
+
+        /// <summary>
+        /// Creates a continuous batching pipeline proposing tokens with a draft model.
+        /// The strings are marshalled for platforms other than Windows.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The created pipeline.</param>
+        /// <param name="modelPath">The model directory.</param>
+        /// <param name="schedulerConfig">The scheduler config.</param>
+        /// <param name="deviceName">The device to run the model on.</param>
+        /// <param name="draftModelPath">The draft model directory.</param>
+        /// <param name="draftDeviceName">The device to run the draft model on.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_create_with_draft_model")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_create_with_draft_model_NotWindows(
+            out ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            [MarshalAs(StringUnmanagedTypeNotWindows)] string modelPath,
+            [In] ref SchedulerConfig schedulerConfig,
+            [MarshalAs(StringUnmanagedTypeNotWindows)] string deviceName,
+            [MarshalAs(StringUnmanagedTypeNotWindows)] string draftModelPath,
+            [MarshalAs(StringUnmanagedTypeNotWindows)] string draftDeviceName);
+
+        /// <summary>
+        /// Creates a continuous batching pipeline proposing tokens with a draft model.
+        /// The strings are marshalled for Windows.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The created pipeline.</param>
+        /// <param name="modelPath">The model directory.</param>
+        /// <param name="schedulerConfig">The scheduler config.</param>
+        /// <param name="deviceName">The device to run the model on.</param>
+        /// <param name="draftModelPath">The draft model directory.</param>
+        /// <param name="draftDeviceName">The device to run the draft model on.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_create_with_draft_model")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_create_with_draft_model_Windows(
+            out ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            [MarshalAs(StringUnmanagedTypeWindows)] string modelPath,
+            [In] ref SchedulerConfig schedulerConfig,
+            [MarshalAs(StringUnmanagedTypeWindows)] string deviceName,
+            [MarshalAs(StringUnmanagedTypeWindows)] string draftModelPath,
+            [MarshalAs(StringUnmanagedTypeWindows)] string draftDeviceName);
+
+        /// <summary>
+        /// Creates a continuous batching pipeline proposing tokens with a draft model.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The created pipeline.</param>
+        /// <param name="modelPath">The model directory.</param>
+        /// <param name="schedulerConfig">The scheduler config.</param>
+        /// <param name="deviceName">The device to run the model on.</param>
+        /// <param name="draftModelPath">The draft model directory.</param>
+        /// <param name="draftDeviceName">The device to run the draft model on.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure]
+        public static ExceptionStatus ov_genai_continuous_batching_pipeline_create_with_draft_model(
+            out ContinuousBatchingPipelineHandle continuousBatchingPipeline, string modelPath,
+            ref SchedulerConfig schedulerConfig, string deviceName, string draftModelPath, string draftDeviceName)
+        {
+            if (IsWindows())
+                return ov_genai_continuous_batching_pipeline_create_with_draft_model_Windows(
+                    out continuousBatchingPipeline, modelPath, ref schedulerConfig, deviceName, draftModelPath,
+                    draftDeviceName);
+            return ov_genai_continuous_batching_pipeline_create_with_draft_model_NotWindows(
+                out continuousBatchingPipeline, modelPath, ref schedulerConfig, deviceName, draftModelPath,
+                draftDeviceName);
+        }
+
+        /// <summary>
+        /// Creates a continuous batching pipeline proposing tokens by prompt lookup.
+        /// The strings are marshalled for platforms other than Windows.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The created pipeline.</param>
+        /// <param name="modelPath">The model directory.</param>
+        /// <param name="schedulerConfig">The scheduler config.</param>
+        /// <param name="deviceName">The device to run the model on.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_create_with_prompt_lookup")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_create_with_prompt_lookup_NotWindows(
+            out ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            [MarshalAs(StringUnmanagedTypeNotWindows)] string modelPath,
+            [In] ref SchedulerConfig schedulerConfig,
+            [MarshalAs(StringUnmanagedTypeNotWindows)] string deviceName);
+
+        /// <summary>
+        /// Creates a continuous batching pipeline proposing tokens by prompt lookup.
+        /// The strings are marshalled for Windows.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The created pipeline.</param>
+        /// <param name="modelPath">The model directory.</param>
+        /// <param name="schedulerConfig">The scheduler config.</param>
+        /// <param name="deviceName">The device to run the model on.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_create_with_prompt_lookup")]
+        public extern static ExceptionStatus ov_genai_continuous_batching_pipeline_create_with_prompt_lookup_Windows(
+            out ContinuousBatchingPipelineHandle continuousBatchingPipeline,
+            [MarshalAs(StringUnmanagedTypeWindows)] string modelPath,
+            [In] ref SchedulerConfig schedulerConfig,
+            [MarshalAs(StringUnmanagedTypeWindows)] string deviceName);
+
+        /// <summary>
+        /// Creates a continuous batching pipeline proposing tokens by prompt lookup.
+        /// </summary>
+        /// <param name="continuousBatchingPipeline">The created pipeline.</param>
+        /// <param name="modelPath">The model directory.</param>
+        /// <param name="schedulerConfig">The scheduler config.</param>
+        /// <param name="deviceName">The device to run the model on.</param>
+        /// <returns>Status code of the operation.</returns>
+        [Pure]
+        public static ExceptionStatus ov_genai_continuous_batching_pipeline_create_with_prompt_lookup(
+            out ContinuousBatchingPipelineHandle continuousBatchingPipeline, string modelPath,
+            ref SchedulerConfig schedulerConfig, string deviceName)
+        {
+            if (IsWindows())
+                return ov_genai_continuous_batching_pipeline_create_with_prompt_lookup_Windows(
+                    out continuousBatchingPipeline, modelPath, ref schedulerConfig, deviceName);
+            return ov_genai_continuous_batching_pipeline_create_with_prompt_lookup_NotWindows(
+                out continuousBatchingPipeline, modelPath, ref schedulerConfig, deviceName);
+        }
+    }
+}
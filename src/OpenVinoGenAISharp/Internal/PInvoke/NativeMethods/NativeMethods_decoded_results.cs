@@ -0,0 +1,15 @@
+﻿using System;
+using System.Runtime.InteropServices;
+using System.Diagnostics.Contracts;
+
+namespace OpenVinoSharp.GenAI.Internal
+{
+    public static partial class NativeMethods
+    {
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_decoded_results_get_texts")]
+        public extern static ExceptionStatus ov_genai_decoded_results_get_texts(
+            DecodedResultsHandle decodedResults,
+            out IntPtr texts);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+﻿using System;
+using System.Runtime.InteropServices;
+using System.Diagnostics.Contracts;
+
+namespace OpenVinoSharp.GenAI.Internal
+{
+    public static partial class NativeMethods
+    {
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_free")]
+        public extern static void ov_genai_llm_pipeline_free(
+            IntPtr llmPipeline);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_continuous_batching_pipeline_free")]
+        public extern static void ov_genai_continuous_batching_pipeline_free(
+            IntPtr continuousBatchingPipeline);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_free")]
+        public extern static void ov_genai_generation_config_free(
+            IntPtr generationConfig);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_decoded_results_free")]
+        public extern static void ov_genai_decoded_results_free(
+            IntPtr decodedResults);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_encoded_results_free")]
+        public extern static void ov_genai_encoded_results_free(
+            IntPtr encodedResults);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_perf_metrics_free")]
+        public extern static void ov_genai_perf_metrics_free(
+            IntPtr perfMetrics);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_raw_perf_metrics_free")]
+        public extern static void ov_genai_raw_perf_metrics_free(
+            IntPtr rawPerfMetrics);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_tokenized_inputs_free")]
+        public extern static void ov_genai_tokenized_inputs_free(
+            IntPtr tokenizedInputs);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_handle_free")]
+        public extern static void ov_genai_generation_handle_free(
+            IntPtr generationHandle);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_outputs_free")]
+        public extern static void ov_genai_generation_outputs_free(
+            IntPtr generationOutputs);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_output_free")]
+        public extern static void ov_genai_generation_output_free(
+            IntPtr generationOutput);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_result_free")]
+        public extern static void ov_genai_generation_result_free(
+            IntPtr generationResult);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_encoded_generation_result_free")]
+        public extern static void ov_genai_encoded_generation_result_free(
+            IntPtr encodedGenerationResult);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_cancellation_token_free")]
+        public extern static void ov_genai_cancellation_token_free(
+            IntPtr cancellationToken);
+    }
+}
@@ -0,0 +1,172 @@
+﻿using System;
+using System.Runtime.InteropServices;
+using System.Diagnostics.Contracts;
+
+namespace OpenVinoSharp.GenAI.Internal
+{
+    public static partial class NativeMethods
+    {
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_create")]
+        public extern static ExceptionStatus ov_genai_generation_config_create(
+            out GenerationConfigHandle generationConfig);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_create_with_json")]
+        public extern static ExceptionStatus ov_genai_generation_config_create_with_json_NotWindows(
+            [MarshalAs(StringUnmanagedTypeNotWindows)] string jsonPath,
+            out GenerationConfigHandle generationConfig);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_create_with_json")]
+        public extern static ExceptionStatus ov_genai_generation_config_create_with_json_Windows(
+            [MarshalAs(StringUnmanagedTypeWindows)] string jsonPath,
+            out GenerationConfigHandle generationConfig);
+
+        [Pure]
+        public static ExceptionStatus ov_genai_generation_config_create_with_json(string jsonPath,
+            out GenerationConfigHandle generationConfig)
+        {
+            if (IsWindows())
+                return ov_genai_generation_config_create_with_json_Windows(jsonPath, out generationConfig);
+            return ov_genai_generation_config_create_with_json_NotWindows(jsonPath, out generationConfig);
+        }
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_get_num_assistant_tokens")]
+        public extern static ExceptionStatus ov_genai_generation_config_get_num_assistant_tokens(
+            GenerationConfigHandle generationConfig,
+            out UIntPtr numAssistantTokens);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_set_num_assistant_tokens")]
+        public extern static ExceptionStatus ov_genai_generation_config_set_num_assistant_tokens(
+            GenerationConfigHandle generationConfig,
+            UIntPtr numAssistantTokens);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_get_assistant_confidence_threshold")]
+        public extern static ExceptionStatus ov_genai_generation_config_get_assistant_confidence_threshold(
+            GenerationConfigHandle generationConfig,
+            out float assistantConfidenceThreshold);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_set_assistant_confidence_threshold")]
+        public extern static ExceptionStatus ov_genai_generation_config_set_assistant_confidence_threshold(
+            GenerationConfigHandle generationConfig,
+            float assistantConfidenceThreshold);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_get_max_ngram_size")]
+        public extern static ExceptionStatus ov_genai_generation_config_get_max_ngram_size(
+            GenerationConfigHandle generationConfig,
+            out UIntPtr maxNgramSize);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_set_max_ngram_size")]
+        public extern static ExceptionStatus ov_genai_generation_config_set_max_ngram_size(
+            GenerationConfigHandle generationConfig,
+            UIntPtr maxNgramSize);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_get_min_new_tokens")]
+        public extern static ExceptionStatus ov_genai_generation_config_get_min_new_tokens(
+            GenerationConfigHandle generationConfig,
+            out UIntPtr minNewTokens);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_set_min_new_tokens")]
+        public extern static ExceptionStatus ov_genai_generation_config_set_min_new_tokens(
+            GenerationConfigHandle generationConfig,
+            UIntPtr minNewTokens);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_get_stop_strings")]
+        public extern static ExceptionStatus ov_genai_generation_config_get_stop_strings(
+            GenerationConfigHandle generationConfig,
+            out IntPtr stopStrings,
+            out UIntPtr size);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_set_stop_strings")]
+        public extern static ExceptionStatus ov_genai_generation_config_set_stop_strings(
+            GenerationConfigHandle generationConfig,
+            IntPtr stopStrings,
+            UIntPtr size);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_get_include_stop_str_in_output")]
+        public extern static ExceptionStatus ov_genai_generation_config_get_include_stop_str_in_output(
+            GenerationConfigHandle generationConfig,
+            [MarshalAs(UnmanagedType.U1)] out bool includeStopStrInOutput);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_set_include_stop_str_in_output")]
+        public extern static ExceptionStatus ov_genai_generation_config_set_include_stop_str_in_output(
+            GenerationConfigHandle generationConfig,
+            [MarshalAs(UnmanagedType.U1)] bool includeStopStrInOutput);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_get_stop_token_ids")]
+        public extern static ExceptionStatus ov_genai_generation_config_get_stop_token_ids(
+            GenerationConfigHandle generationConfig,
+            [Out] long[] stopTokenIds,
+            UIntPtr capacity,
+            out UIntPtr size);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_set_stop_token_ids")]
+        public extern static ExceptionStatus ov_genai_generation_config_set_stop_token_ids(
+            GenerationConfigHandle generationConfig,
+            [In] long[] stopTokenIds,
+            UIntPtr size);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_get_logprobs")]
+        public extern static ExceptionStatus ov_genai_generation_config_get_logprobs(
+            GenerationConfigHandle generationConfig,
+            out UIntPtr logprobs);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_set_logprobs")]
+        public extern static ExceptionStatus ov_genai_generation_config_set_logprobs(
+            GenerationConfigHandle generationConfig,
+            UIntPtr logprobs);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_get_presence_penalty")]
+        public extern static ExceptionStatus ov_genai_generation_config_get_presence_penalty(
+            GenerationConfigHandle generationConfig,
+            out float presencePenalty);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_set_presence_penalty")]
+        public extern static ExceptionStatus ov_genai_generation_config_set_presence_penalty(
+            GenerationConfigHandle generationConfig,
+            float presencePenalty);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_get_frequency_penalty")]
+        public extern static ExceptionStatus ov_genai_generation_config_get_frequency_penalty(
+            GenerationConfigHandle generationConfig,
+            out float frequencyPenalty);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_set_frequency_penalty")]
+        public extern static ExceptionStatus ov_genai_generation_config_set_frequency_penalty(
+            GenerationConfigHandle generationConfig,
+            float frequencyPenalty);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_get_rng_seed")]
+        public extern static ExceptionStatus ov_genai_generation_config_get_rng_seed(
+            GenerationConfigHandle generationConfig,
+            out UIntPtr rngSeed);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_config_set_rng_seed")]
+        public extern static ExceptionStatus ov_genai_generation_config_set_rng_seed(
+            GenerationConfigHandle generationConfig,
+            UIntPtr rngSeed);
+    }
+}
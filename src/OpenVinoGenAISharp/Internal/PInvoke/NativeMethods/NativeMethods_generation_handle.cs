@@ -0,0 +1,27 @@
+﻿using System;
+using System.Runtime.InteropServices;
+using System.Diagnostics.Contracts;
+
+namespace OpenVinoSharp.GenAI.Internal
+{
+    public static partial class NativeMethods
+    {
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_handle_drop")]
+        public extern static ExceptionStatus ov_genai_generation_handle_drop(
+            GenerationHandleSafeHandle generationHandle);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_handle_stream")]
+        public extern static ExceptionStatus ov_genai_generation_handle_stream(
+            GenerationHandleSafeHandle generationHandle,
+            out int finished);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_generation_handle_try_read")]
+        public extern static ExceptionStatus ov_genai_generation_handle_try_read(
+            GenerationHandleSafeHandle generationHandle,
+            out GenerationOutputsHandle generationOutputs,
+            out TryStatus result);
+    }
+}
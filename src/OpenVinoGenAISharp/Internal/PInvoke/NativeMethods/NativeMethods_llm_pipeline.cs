@@ -13,5 +13,230 @@ namespace OpenVinoSharp.GenAI.Internal
         [Pure, DllImport(dllExtern, EntryPoint = "ov_genai_llm_sizeof",
             CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         public extern static ExceptionStatus ov_genai_llm_sizeof();
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_create_with_model_path")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_create_with_model_path_NotWindows(
+            [MarshalAs(StringUnmanagedTypeNotWindows)] string modelPath,
+            [MarshalAs(StringUnmanagedTypeNotWindows)] string deviceName,
+            out LLMPipelineHandle llmPipeline,
+            IntPtr propertyEnd);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_create_with_model_path")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_create_with_model_path_Windows(
+            [MarshalAs(StringUnmanagedTypeWindows)] string modelPath,
+            [MarshalAs(StringUnmanagedTypeWindows)] string deviceName,
+            out LLMPipelineHandle llmPipeline,
+            IntPtr propertyEnd);
+
+        [Pure]
+        public static ExceptionStatus ov_genai_llm_pipeline_create_with_model_path(string modelPath, string deviceName,
+            out LLMPipelineHandle llmPipeline)
+        {
+            // IntPtr.Zero ends the empty property list of the variadic function
+            if (IsWindows())
+                return ov_genai_llm_pipeline_create_with_model_path_Windows(modelPath, deviceName, out llmPipeline, IntPtr.Zero);
+            return ov_genai_llm_pipeline_create_with_model_path_NotWindows(modelPath, deviceName, out llmPipeline, IntPtr.Zero);
+        }
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_generate_string_with_streamer")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_generate_string_with_streamer(
+            LLMPipelineHandle llmPipeline,
+            [In] byte[] inputs,
+            GenerationConfigHandle generationConfig,
+            [In] ref Streamer streamer,
+            out DecodedResultsHandle decodedResults);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_generate_string_with_streamer")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_generate_string_with_streamer(
+            LLMPipelineHandle llmPipeline,
+            [In] byte[] inputs,
+            IntPtr generationConfig,
+            [In] ref Streamer streamer,
+            out DecodedResultsHandle decodedResults);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_generate_string")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_generate_string(
+            LLMPipelineHandle llmPipeline,
+            [In] byte[] inputs,
+            out DecodedResultsHandle decodedResults);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_generate_string_with_config")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_generate_string_with_config(
+            LLMPipelineHandle llmPipeline,
+            [In] byte[] inputs,
+            GenerationConfigHandle generationConfig,
+            out DecodedResultsHandle decodedResults);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_set_cancellation_token")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_set_cancellation_token(
+            LLMPipelineHandle llmPipeline,
+            CancellationTokenHandle cancellationToken);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_set_cancellation_token")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_set_cancellation_token(
+            LLMPipelineHandle llmPipeline,
+            IntPtr cancellationToken);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_set_completion_cache")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_set_completion_cache(
+            LLMPipelineHandle llmPipeline,
+            [In] ref CompletionCacheConfig cacheConfig);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_set_completion_cache")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_set_completion_cache(
+            LLMPipelineHandle llmPipeline,
+            IntPtr cacheConfig);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_get_completion_cache_stats")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_get_completion_cache_stats(
+            LLMPipelineHandle llmPipeline,
+            out CompletionCacheStats cacheStats);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_generate_start_chat")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_generate_start_chat(
+            LLMPipelineHandle llmPipeline);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_generate_finish_chat")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_generate_finish_chat(
+            LLMPipelineHandle llmPipeline);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_export_chat")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_export_chat(
+            LLMPipelineHandle llmPipeline,
+            out IntPtr blob,
+            out UIntPtr blobSize);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_import_chat")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_import_chat(
+            LLMPipelineHandle llmPipeline,
+            [In] byte[] blob,
+            UIntPtr blobSize);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_set_chat_sessions")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_set_chat_sessions(
+            LLMPipelineHandle llmPipeline,
+            [In] ref ChatSessionsConfig sessionsConfig);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_set_chat_sessions")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_set_chat_sessions(
+            LLMPipelineHandle llmPipeline,
+            IntPtr sessionsConfig);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_generate_in_session")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_generate_in_session(
+            LLMPipelineHandle llmPipeline,
+            [In] byte[] sessionId,
+            [In] byte[] inputs,
+            GenerationConfigHandle generationConfig,
+            IntPtr streamer,
+            out DecodedResultsHandle decodedResults);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_generate_in_session")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_generate_in_session(
+            LLMPipelineHandle llmPipeline,
+            [In] byte[] sessionId,
+            [In] byte[] inputs,
+            IntPtr generationConfig,
+            IntPtr streamer,
+            out DecodedResultsHandle decodedResults);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_evict_idle_sessions")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_evict_idle_sessions(
+            LLMPipelineHandle llmPipeline,
+            out UIntPtr evicted);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_end_session")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_end_session(
+            LLMPipelineHandle llmPipeline,
+            [In] byte[] sessionId);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_get_chat_sessions_stats")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_get_chat_sessions_stats(
+            LLMPipelineHandle llmPipeline,
+            out ChatSessionsStats sessionsStats);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_create_with_draft_model")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_create_with_draft_model_NotWindows(
+            [MarshalAs(StringUnmanagedTypeNotWindows)] string modelPath,
+            [MarshalAs(StringUnmanagedTypeNotWindows)] string deviceName,
+            [MarshalAs(StringUnmanagedTypeNotWindows)] string draftModelPath,
+            [MarshalAs(StringUnmanagedTypeNotWindows)] string draftDeviceName,
+            out LLMPipelineHandle llmPipeline,
+            IntPtr propertyEnd);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_create_with_draft_model")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_create_with_draft_model_Windows(
+            [MarshalAs(StringUnmanagedTypeWindows)] string modelPath,
+            [MarshalAs(StringUnmanagedTypeWindows)] string deviceName,
+            [MarshalAs(StringUnmanagedTypeWindows)] string draftModelPath,
+            [MarshalAs(StringUnmanagedTypeWindows)] string draftDeviceName,
+            out LLMPipelineHandle llmPipeline,
+            IntPtr propertyEnd);
+
+        [Pure]
+        public static ExceptionStatus ov_genai_llm_pipeline_create_with_draft_model(string modelPath, string deviceName,
+            string draftModelPath, string draftDeviceName, out LLMPipelineHandle llmPipeline)
+        {
+            if (IsWindows())
+                return ov_genai_llm_pipeline_create_with_draft_model_Windows(modelPath, deviceName, draftModelPath,
+                    draftDeviceName, out llmPipeline, IntPtr.Zero);
+            return ov_genai_llm_pipeline_create_with_draft_model_NotWindows(modelPath, deviceName, draftModelPath,
+                draftDeviceName, out llmPipeline, IntPtr.Zero);
+        }
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_get_speculative_metrics")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_get_speculative_metrics(
+            LLMPipelineHandle llmPipeline,
+            out SpeculativeMetrics speculativeMetrics);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_create_with_prompt_lookup")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_create_with_prompt_lookup_NotWindows(
+            [MarshalAs(StringUnmanagedTypeNotWindows)] string modelPath,
+            [MarshalAs(StringUnmanagedTypeNotWindows)] string deviceName,
+            out LLMPipelineHandle llmPipeline,
+            IntPtr propertyEnd);
+
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_llm_pipeline_create_with_prompt_lookup")]
+        public extern static ExceptionStatus ov_genai_llm_pipeline_create_with_prompt_lookup_Windows(
+            [MarshalAs(StringUnmanagedTypeWindows)] string modelPath,
+            [MarshalAs(StringUnmanagedTypeWindows)] string deviceName,
+            out LLMPipelineHandle llmPipeline,
+            IntPtr propertyEnd);
+
+        [Pure]
+        public static ExceptionStatus ov_genai_llm_pipeline_create_with_prompt_lookup(string modelPath, string deviceName,
+            out LLMPipelineHandle llmPipeline)
+        {
+            if (IsWindows())
+                return ov_genai_llm_pipeline_create_with_prompt_lookup_Windows(modelPath, deviceName, out llmPipeline, IntPtr.Zero);
+            return ov_genai_llm_pipeline_create_with_prompt_lookup_NotWindows(modelPath, deviceName, out llmPipeline, IntPtr.Zero);
+        }
     }
 }
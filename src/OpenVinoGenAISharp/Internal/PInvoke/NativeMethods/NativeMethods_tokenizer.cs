@@ -12,6 +12,11 @@ namespace OpenVinoSharp.GenAI.Internal
         public extern static ExceptionStatus ov_genai_tokenizer_create(
             [Out] IntPtr tokenizer);
 
+        [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
+            ExactSpelling = true, EntryPoint = "ov_genai_tokenizer_create")]
+        public extern static ExceptionStatus ov_genai_tokenizer_create(
+            out TokenizerHandle tokenizer);
+
         [Pure, DllImport(dllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true,
             ExactSpelling = true, EntryPoint = "ov_genai_tokenizer_create_with_path")]
         public extern static ExceptionStatus ov_genai_tokenizer_create_with_path_NotWindows(
@@ -11,19 +11,62 @@ namespace OpenVinoSharp.GenAI.Internal
     public static class StructCommon
     {
 
+        /// <summary>
+        /// Copies strings into one newly allocated native block as UTF-8, pointer table first.
+        /// </summary>
+        /// <param name="strs">The strings to copy.</param>
+        /// <returns>The array, release it with <see cref="FreeStringArray"/>.</returns>
+        /// <remarks>For repeated batches, <see cref="Utf8StringArray"/> keeps the block between calls.</remarks>
         public static StringArray StringArrayToStruct(string[] strs)
         {
-            StringArray stringArray = new StringArray();
-            ulong size = (ulong)strs.Length;
-            IntPtr[] str_ptrs = new IntPtr[strs.Length];
-            for (int i = 0; i < strs.Length; ++i)
+            if (strs is null)
+                throw new ArgumentNullException(nameof(strs));
+            int size = Utf8StringArray.RequiredSize(strs);
+            IntPtr data = Marshal.AllocHGlobal(size);
+            unsafe
             {
-                str_ptrs[i] = Marshal.StringToHGlobalAnsi(strs[i]);
+                return Utf8StringArray.Write((byte*)data, size, strs);
             }
+        }
+
+        /// <summary>
+        /// Copies a string into a NUL terminated UTF-8 array, the encoding the tokenizers expect on every platform.
+        /// </summary>
+        /// <param name="str">The string to copy.</param>
+        /// <returns>The bytes.</returns>
+        public static byte[] StringToUtf8(string str)
+        {
+            if (str is null)
+                throw new ArgumentNullException(nameof(str));
+            byte[] bytes = new byte[Encoding.UTF8.GetByteCount(str) + 1];
+            Encoding.UTF8.GetBytes(str, 0, str.Length, bytes, 0);
+            return bytes;
+        }
 
-            IntPtr data = Marshal.AllocHGlobal(IntPtr.Size * strs.Length);
-            Marshal.Copy(str_ptrs, 0, data, strs.Length);
-            return new StringArray { Data = data, Size = size };
+        /// <summary>
+        /// Reads a NUL terminated UTF-8 string returned by the native library.
+        /// </summary>
+        /// <param name="ptr">The string, freed by the caller.</param>
+        /// <returns>The string, empty for a null pointer.</returns>
+        public static unsafe string Utf8ToString(IntPtr ptr)
+        {
+            if (ptr == IntPtr.Zero)
+                return string.Empty;
+            byte* bytes = (byte*)ptr;
+            int length = 0;
+            while (bytes[length] != 0)
+                length++;
+            return Encoding.UTF8.GetString(bytes, length);
+        }
+
+        /// <summary>
+        /// Releases an array returned by <see cref="StringArrayToStruct"/>.
+        /// </summary>
+        /// <param name="stringArray">The array to release.</param>
+        public static void FreeStringArray(StringArray stringArray)
+        {
+            if (stringArray.Data != IntPtr.Zero)
+                Marshal.FreeHGlobal(stringArray.Data);
         }
     }
 }
@@ -0,0 +1,20 @@
+﻿using System;
+
+namespace OpenVinoSharp.GenAI.Internal
+{
+    /// <summary>
+    /// ov_genai_streamer_t, a streamer callback and the state passed back to it.
+    /// </summary>
+    public struct Streamer
+    {
+        /// <summary>
+        /// The ov_genai_stream_callback_t receiving each new piece of text as UTF-8 bytes.
+        /// </summary>
+        public IntPtr Callback;
+
+        /// <summary>
+        /// The state passed back to the callback.
+        /// </summary>
+        public IntPtr UserData;
+    }
+}
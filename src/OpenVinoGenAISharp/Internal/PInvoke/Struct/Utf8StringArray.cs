@@ -0,0 +1,136 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace OpenVinoSharp.GenAI.Internal
+{
+    /// <summary>
+    /// A reusable native arena holding a batch of null-terminated UTF-8 strings and their pointer table,
+    /// in the layout of <c>ov_genai_char_arrays_t</c>.
+    /// </summary>
+    /// <remarks>
+    /// The pointer table sits at the start of one native block and the strings follow it, so a batch costs
+    /// one allocation at most, and none once the arena has grown to the largest batch seen. Encoding a new
+    /// batch invalidates the previous <see cref="StringArray"/>. An instance is not thread safe, keep one per
+    /// worker or per request loop.
+    /// </remarks>
+    public sealed unsafe class Utf8StringArray : IDisposable
+    {
+        private byte* block;
+        private int capacity;
+
+        /// <summary>
+        /// Creates an arena, optionally with an initial capacity in bytes.
+        /// </summary>
+        /// <param name="initialCapacity">The initial size of the native block.</param>
+        public Utf8StringArray(int initialCapacity = 0)
+        {
+            if (initialCapacity < 0)
+                throw new ArgumentOutOfRangeException(nameof(initialCapacity));
+            if (initialCapacity > 0)
+                Grow(initialCapacity);
+        }
+
+        /// <summary>
+        /// Gets the size of the native block in bytes.
+        /// </summary>
+        public int Capacity => capacity;
+
+        /// <summary>
+        /// Encodes strings into the arena, growing it when needed.
+        /// </summary>
+        /// <param name="strings">The strings to encode.</param>
+        /// <returns>A StringArray pointing into the arena, valid until the next call or Dispose.</returns>
+        public StringArray Encode(IReadOnlyList<string> strings)
+        {
+            if (strings is null)
+                throw new ArgumentNullException(nameof(strings));
+            if (capacity < 0)
+                throw new ObjectDisposedException(nameof(Utf8StringArray));
+
+            int required = RequiredSize(strings);
+            if (required > capacity)
+                Grow(Math.Max(required, capacity > int.MaxValue / 2 ? int.MaxValue : capacity * 2));
+            return Write(block, required, strings);
+        }
+
+        /// <summary>
+        /// Size of the block holding strings, pointer table included.
+        /// </summary>
+        internal static int RequiredSize(IReadOnlyList<string> strings)
+        {
+            long required = (long)IntPtr.Size * strings.Count;
+            for (int i = 0; i < strings.Count; ++i)
+                required += Encoding.UTF8.GetByteCount(strings[i] ?? throw new ArgumentNullException(nameof(strings))) + 1;
+            if (required > int.MaxValue)
+                throw new ArgumentOutOfRangeException(nameof(strings), "The batch does not fit in one native block.");
+            return (int)required;
+        }
+
+        /// <summary>
+        /// Writes the pointer table and the strings into a block of at least RequiredSize bytes.
+        /// </summary>
+        internal static StringArray Write(byte* block, int size, IReadOnlyList<string> strings)
+        {
+            int count = strings.Count;
+            IntPtr* table = (IntPtr*)block;
+            byte* text = block + IntPtr.Size * count;
+            byte* end = block + size;
+            for (int i = 0; i < count; ++i)
+            {
+                table[i] = (IntPtr)text;
+                int written;
+                fixed (char* chars = strings[i])
+                {
+                    written = Encoding.UTF8.GetBytes(chars, strings[i].Length, text, (int)(end - text));
+                }
+                text[written] = 0;
+                text += written + 1;
+            }
+            return new StringArray { Data = (IntPtr)block, Size = (ulong)count };
+        }
+
+        private void Grow(int size)
+        {
+            Free();
+#if NET6_0_OR_GREATER
+            block = (byte*)NativeMemory.Alloc((nuint)size);
+#else
+            block = (byte*)Marshal.AllocHGlobal(size);
+#endif
+            capacity = size;
+        }
+
+        private void Free()
+        {
+            if (block == null)
+                return;
+#if NET6_0_OR_GREATER
+            NativeMemory.Free(block);
+#else
+            Marshal.FreeHGlobal((IntPtr)block);
+#endif
+            block = null;
+            capacity = 0;
+        }
+
+        /// <summary>
+        /// Releases the native block.
+        /// </summary>
+        public void Dispose()
+        {
+            Free();
+            capacity = -1;
+            GC.SuppressFinalize(this);
+        }
+
+        /// <summary>
+        /// Destructor
+        /// </summary>
+        ~Utf8StringArray()
+        {
+            Free();
+        }
+    }
+}
@@ -0,0 +1,36 @@
+﻿using System;
+
+namespace OpenVinoSharp.GenAI.Internal
+{
+    /// <summary>
+    /// ov_genai_try_status_e, the outcome of the try_ functions for the conditions expected while serving
+    /// requests. Errors are still returned as <see cref="ExceptionStatus"/>.
+    /// </summary>
+    public enum TryStatus : int
+    {
+        /// <summary>
+        /// The operation was done.
+        /// </summary>
+        OK = 0,
+        /// <summary>
+        /// The pipeline takes no more requests for now, retry after a step.
+        /// </summary>
+        QUEUE_FULL = 1,
+        /// <summary>
+        /// The request is running and has no output ready yet.
+        /// </summary>
+        NO_DATA = 2,
+        /// <summary>
+        /// The request has finished and all of its output has been read.
+        /// </summary>
+        FINISHED = 3,
+        /// <summary>
+        /// The request was dropped, by its handle or by the pipeline.
+        /// </summary>
+        DROPPED = 4,
+        /// <summary>
+        /// The pipeline has no request left to step.
+        /// </summary>
+        IDLE = 5,
+    }
+}
@@ -0,0 +1,135 @@
+﻿#if NETCOREAPP3_0_OR_GREATER
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace OpenVinoSharp.GenAI.Internal
+{
+    /// <summary>
+    /// Resolves openvino_genai_c on Linux and macOS through <see cref="NativeLibrary.SetDllImportResolver"/>.
+    /// </summary>
+    /// <remarks>
+    /// The resolver needs no reflection, so it works in trimmed and Native AOT applications. The library is
+    /// searched in the additional paths, then in the directories of the OPENVINO_GENAI_LIBRARY_PATH variable,
+    /// then next to the application. It is opened with RTLD_NOW, so all of its symbols are bound at load
+    /// time instead of on the first request that reaches them. When nothing is found the runtime probes as usual.
+    /// In a Native AOT application the P/Invokes can also be bound at link time with
+    /// <c>&lt;DirectPInvoke Include="openvino_genai_c" /&gt;</c>, which bypasses the resolver.
+    /// </remarks>
+    public static unsafe class UnixLibraryLoader
+    {
+        /// <summary>
+        /// Environment variable listing extra directories, separated like PATH.
+        /// </summary>
+        public const string LibraryPathVariable = "OPENVINO_GENAI_LIBRARY_PATH";
+
+        private const int RTLD_NOW = 0x002;
+        private const int RTLD_GLOBAL_LINUX = 0x100;
+        private const int RTLD_GLOBAL_OSX = 0x008;
+
+        private static readonly object syncLock = new();
+        private static readonly Dictionary<string, IntPtr> loaded = new(StringComparer.Ordinal);
+        private static bool registered;
+
+        /// <summary>
+        /// Installs the resolver for the assembly of <see cref="NativeMethods"/>, once.
+        /// </summary>
+        /// <param name="additionalPaths">Directories or files searched first.</param>
+        public static void Register(IEnumerable<string> additionalPaths = null)
+        {
+            lock (syncLock)
+            {
+                if (registered)
+                    return;
+                registered = true;
+                var paths = new List<string>(additionalPaths ?? Array.Empty<string>());
+                NativeLibrary.SetDllImportResolver(typeof(NativeMethods).Assembly,
+                    (libraryName, assembly, searchPath) => Resolve(libraryName, paths));
+            }
+        }
+
+        private static IntPtr Resolve(string libraryName, List<string> additionalPaths)
+        {
+            lock (syncLock)
+            {
+                if (loaded.TryGetValue(libraryName, out IntPtr cached))
+                    return cached;
+
+                IntPtr handle = IntPtr.Zero;
+                foreach (string candidate in Candidates(libraryName, additionalPaths))
+                {
+                    handle = Open(candidate);
+                    if (handle != IntPtr.Zero)
+                        break;
+                }
+                // remember misses too, the default probing is not retried through here
+                loaded[libraryName] = handle;
+                return handle;
+            }
+        }
+
+        private static IEnumerable<string> Candidates(string libraryName, List<string> additionalPaths)
+        {
+            string fileName = FileName(libraryName);
+            var directories = new List<string>(additionalPaths);
+            string variable = Environment.GetEnvironmentVariable(LibraryPathVariable);
+            if (!string.IsNullOrEmpty(variable))
+                directories.AddRange(variable.Split(Path.PathSeparator, StringSplitOptions.RemoveEmptyEntries));
+            directories.Add(AppContext.BaseDirectory);
+
+            foreach (string directory in directories)
+            {
+                if (File.Exists(directory) && Path.GetFileName(directory) == fileName)
+                    yield return directory;
+                string path = Path.Combine(directory, fileName);
+                if (File.Exists(path))
+                    yield return path;
+            }
+        }
+
+        private static string FileName(string libraryName)
+        {
+            if (libraryName.Contains('/') || libraryName.EndsWith(".so", StringComparison.Ordinal)
+                || libraryName.EndsWith(".dylib", StringComparison.Ordinal))
+                return Path.GetFileName(libraryName);
+            return RuntimeInformation.IsOSPlatform(OSPlatform.OSX) ? $"lib{libraryName}.dylib" : $"lib{libraryName}.so";
+        }
+
+        /// <summary>
+        /// dlopen with RTLD_NOW, falling back to <see cref="NativeLibrary.TryLoad(string, out IntPtr)"/>
+        /// (which binds lazily) when libdl cannot be reached.
+        /// </summary>
+        private static IntPtr Open(string path)
+        {
+            bool osx = RuntimeInformation.IsOSPlatform(OSPlatform.OSX);
+            int flags = RTLD_NOW | (osx ? RTLD_GLOBAL_OSX : RTLD_GLOBAL_LINUX);
+            byte[] bytes = Encoding.UTF8.GetBytes(path + "\0");
+            try
+            {
+                fixed (byte* file = bytes)
+                {
+                    IntPtr handle = osx ? dlopen_osx(file, flags) : dlopen_linux(file, flags);
+                    if (handle != IntPtr.Zero)
+                        return handle;
+                }
+            }
+            catch (DllNotFoundException)
+            {
+            }
+            catch (EntryPointNotFoundException)
+            {
+            }
+            return NativeLibrary.TryLoad(path, out IntPtr fallback) ? fallback : IntPtr.Zero;
+        }
+
+        // libdl.so.2 still exists on glibc 2.34 and later, where dlopen moved into libc.
+        [DllImport("libdl.so.2", EntryPoint = "dlopen", ExactSpelling = true)]
+        private static extern IntPtr dlopen_linux(byte* file, int flags);
+
+        [DllImport("libSystem.dylib", EntryPoint = "dlopen", ExactSpelling = true)]
+        private static extern IntPtr dlopen_osx(byte* file, int flags);
+    }
+}
+#endif
@@ -0,0 +1,74 @@
+﻿#if NET7_0_OR_GREATER
+#nullable enable
+using System;
+using System.Buffers;
+using System.Text;
+
+namespace OpenVinoSharp.GenAI.Internal
+{
+    /// <summary>
+    /// Null-terminated UTF-8 copy of a string for the blittable P/Invoke layer, encoded into a caller
+    /// supplied stack buffer and falling back to an <see cref="ArrayPool{T}"/> array when it does not fit.
+    /// </summary>
+    /// <example>
+    /// using var path = new Utf8StringMarshaller(modelPath, stackalloc byte[Utf8StringMarshaller.StackBufferSize]);
+    /// fixed (byte* p = path) { ... }
+    /// </example>
+    public ref struct Utf8StringMarshaller
+    {
+        /// <summary>
+        /// Suggested size of the stack buffer, long enough for paths and device names.
+        /// </summary>
+        public const int StackBufferSize = 256;
+
+        private byte[]? rented;
+        private readonly Span<byte> bytes;
+
+        /// <summary>
+        /// Encodes text into stackBuffer, or into a pooled array when stackBuffer is too small.
+        /// </summary>
+        /// <param name="text">The text to encode.</param>
+        /// <param name="stackBuffer">A buffer owned by the caller, usually stackalloc'ed.</param>
+        public Utf8StringMarshaller(ReadOnlySpan<char> text, Span<byte> stackBuffer)
+        {
+            rented = null;
+            Span<byte> buffer = stackBuffer;
+            // the worst case is checked first so that short strings are encoded in a single pass
+            if (Encoding.UTF8.GetMaxByteCount(text.Length) + 1 > stackBuffer.Length)
+            {
+                int length = Encoding.UTF8.GetByteCount(text) + 1;
+                if (length > stackBuffer.Length)
+                {
+                    rented = ArrayPool<byte>.Shared.Rent(length);
+                    buffer = rented;
+                }
+            }
+            int written = Encoding.UTF8.GetBytes(text, buffer);
+            buffer[written] = 0;
+            bytes = buffer.Slice(0, written + 1);
+        }
+
+        /// <summary>
+        /// The encoded bytes including the terminating zero.
+        /// </summary>
+        public readonly ReadOnlySpan<byte> Bytes => bytes;
+
+        /// <summary>
+        /// Allows <c>fixed (byte* p = marshaller)</c>.
+        /// </summary>
+        public readonly ref byte GetPinnableReference() => ref bytes.GetPinnableReference();
+
+        /// <summary>
+        /// Returns the pooled array, if any.
+        /// </summary>
+        public void Dispose()
+        {
+            if (rented is not null)
+            {
+                ArrayPool<byte>.Shared.Return(rented);
+                rented = null;
+            }
+        }
+    }
+}
+#endif
@@ -0,0 +1,60 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace OpenVinoSharp.GenAI
+{
+    /// <summary>
+    /// ov_genai_admission_config_t, the limits of the admission control of a <see cref="ContinuousBatchingPipeline"/>.
+    /// A queued request is one admitted which has not produced its first token yet. 0 disables a limit.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct AdmissionConfig
+    {
+        /// <summary>
+        /// Maximum number of queued requests.
+        /// </summary>
+        public ulong MaxQueuedRequests;
+
+        /// <summary>
+        /// Maximum number of prompt tokens of the queued requests.
+        /// </summary>
+        public ulong MaxQueuedPromptTokens;
+
+        /// <summary>
+        /// KV cache usage in percent from which no request is admitted.
+        /// </summary>
+        public float MaxCacheUsage;
+    }
+
+    /// <summary>
+    /// ov_genai_admission_state_t, the load seen by the admission control of a <see cref="ContinuousBatchingPipeline"/>.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct AdmissionState
+    {
+        /// <summary>
+        /// Number of queued requests.
+        /// </summary>
+        public ulong QueuedRequests;
+
+        /// <summary>
+        /// Number of prompt tokens of the queued requests.
+        /// </summary>
+        public ulong QueuedPromptTokens;
+
+        /// <summary>
+        /// Percentage of KV cache usage.
+        /// </summary>
+        public float CacheUsage;
+
+        /// <summary>
+        /// Suggested wait before a rejected request is sent again in milliseconds, 0 until the pipeline has stepped.
+        /// </summary>
+        public ulong RetryAfterMs;
+
+        /// <summary>
+        /// <see cref="RetryAfterMs"/> as a time span.
+        /// </summary>
+        public TimeSpan RetryAfter => TimeSpan.FromMilliseconds(RetryAfterMs);
+    }
+}
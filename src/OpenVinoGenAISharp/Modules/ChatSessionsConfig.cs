@@ -0,0 +1,73 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace OpenVinoSharp.GenAI
+{
+    /// <summary>
+    /// ov_genai_chat_sessions_config_t, the bounds of the chat sessions of a pipeline. A session keeps the messages
+    /// of one conversation by id, the least recently used first out of memory into a snapshot file. Without a
+    /// directory for them the messages stay in memory and only the KV cache of a session is dropped.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ChatSessionsConfig
+    {
+        /// <summary>
+        /// Maximum number of sessions in memory when there is a <see cref="SnapshotDir"/>, 0 for no limit.
+        /// </summary>
+        public ulong MaxSessions;
+
+        /// <summary>
+        /// How long a session holding the KV cache of an <see cref="LLMPipeline"/> stays idle before
+        /// <see cref="LLMPipeline.EvictIdleSessions"/> drops it, 0 for ever.
+        /// </summary>
+        public ulong IdleMs;
+
+        /// <summary>
+        /// The directory of the snapshot files of the sessions out of memory, null to keep every session in memory.
+        /// </summary>
+        [MarshalAs(UnmanagedType.LPUTF8Str)]
+        public string SnapshotDir;
+    }
+
+    /// <summary>
+    /// ov_genai_chat_sessions_stats_t, the counters of the chat sessions of a pipeline.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ChatSessionsStats
+    {
+        /// <summary>
+        /// Sessions in memory.
+        /// </summary>
+        public ulong Sessions;
+
+        /// <summary>
+        /// Sessions holding the KV cache of the pipeline.
+        /// </summary>
+        public ulong Resident;
+
+        /// <summary>
+        /// Turns answered in a session.
+        /// </summary>
+        public ulong Turns;
+
+        /// <summary>
+        /// KV caches of idle or least recently used sessions dropped.
+        /// </summary>
+        public ulong Evictions;
+
+        /// <summary>
+        /// Turns which prefilled the whole history of their session again.
+        /// </summary>
+        public ulong RePrefills;
+
+        /// <summary>
+        /// Sessions written to a snapshot file on their way out of memory.
+        /// </summary>
+        public ulong SnapshotsWritten;
+
+        /// <summary>
+        /// Sessions read back from a snapshot file.
+        /// </summary>
+        public ulong SnapshotsRestored;
+    }
+}
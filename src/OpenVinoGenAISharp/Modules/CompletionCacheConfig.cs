@@ -0,0 +1,74 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace OpenVinoSharp.GenAI
+{
+    /// <summary>
+    /// ov_genai_completion_cache_config_t, the bounds of a completion cache, which replays the outputs of greedy
+    /// requests seen before. The entries are kept in memory, least recently used first out, and optionally in a
+    /// memory mapped file which outlives the process. The file holds the outputs of the model named in its header,
+    /// a file of another model is refused, and only the cache which opened it may use it.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct CompletionCacheConfig
+    {
+        /// <summary>
+        /// Maximum number of entries in memory, 0 for no limit.
+        /// </summary>
+        public ulong MaxEntries;
+
+        /// <summary>
+        /// Maximum size of the entries in memory in bytes, 0 for no limit.
+        /// </summary>
+        public ulong MaxBytes;
+
+        /// <summary>
+        /// The file of the mapped tier, null to keep the entries in memory only.
+        /// </summary>
+        [MarshalAs(UnmanagedType.LPUTF8Str)]
+        public string DiskPath;
+
+        /// <summary>
+        /// Size of the file in bytes, the tier starts over when it is full.
+        /// </summary>
+        public ulong DiskSize;
+
+        /// <summary>
+        /// Identity of the model, its path for instance, part of every key. Required with <see cref="DiskPath"/>.
+        /// </summary>
+        [MarshalAs(UnmanagedType.LPUTF8Str)]
+        public string ModelId;
+    }
+
+    /// <summary>
+    /// ov_genai_completion_cache_stats_t, the counters of a completion cache.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct CompletionCacheStats
+    {
+        /// <summary>
+        /// Lookups served from memory.
+        /// </summary>
+        public ulong Hits;
+
+        /// <summary>
+        /// Lookups served from the mapped file.
+        /// </summary>
+        public ulong DiskHits;
+
+        /// <summary>
+        /// Lookups that found nothing.
+        /// </summary>
+        public ulong Misses;
+
+        /// <summary>
+        /// Entries in memory.
+        /// </summary>
+        public ulong Entries;
+
+        /// <summary>
+        /// Size of the entries in memory in bytes.
+        /// </summary>
+        public ulong Bytes;
+    }
+}
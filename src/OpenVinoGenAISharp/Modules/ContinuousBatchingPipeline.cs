@@ -0,0 +1,634 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+using System.Threading;
+using System.Threading.Tasks;
+using OpenVinoSharp.GenAI.Internal;
+
+namespace OpenVinoSharp.GenAI
+{
+    /// <summary>
+    /// ov::genai::ContinuousBatchingPipeline, text generation batching the steps of many requests.
+    /// </summary>
+    /// <remarks>
+    /// The requests added by <see cref="AddRequestAsync(string, GenerationConfig, CancellationToken)"/> and its
+    /// overloads are run by one step loop on a thread of its own, started with the first request and ended with
+    /// the last one.
+    /// </remarks>
+    public sealed class ContinuousBatchingPipeline : IDisposable
+    {
+        /// <summary>
+        /// A request of the step loop.
+        /// </summary>
+        private sealed class StreamingRequest
+        {
+            public StreamingRequest(GenerationHandleSafeHandle generation, TextStreamChannel stream)
+            {
+                Generation = generation;
+                Stream = stream;
+            }
+
+            public GenerationHandleSafeHandle Generation { get; }
+            public TextStreamChannel Stream { get; }
+            // set once the native request is over, the loop then only hands over the rest of the text
+            public bool Finished { get; set; }
+
+            public void Drop()
+            {
+                Stream.Cancel();
+                try
+                {
+                    NativeMethods.ov_genai_generation_handle_drop(Generation);
+                }
+                catch (ObjectDisposedException)
+                {
+                    // already finished and released by the loop
+                }
+            }
+        }
+
+        private readonly ContinuousBatchingPipelineHandle handle;
+        private readonly object syncLock = new();
+        private readonly List<StreamingRequest> requests = new();
+        // wakes the loop when it has nothing to step
+        private readonly ManualResetEventSlim wake = new(false);
+        private Task loop;
+        private long nextRequestId;
+        // completed after each step, when a full pipeline may have room again
+        private TaskCompletionSource<bool> stepped = NewStepSignal();
+        // a full pipeline rejects new requests instead of making them wait
+        private volatile bool admissionControl;
+
+        /// <summary>
+        /// Constructs the pipeline from the model, tokenizer and generation_config.json in one directory.
+        /// </summary>
+        /// <param name="modelPath">The model directory.</param>
+        /// <param name="schedulerConfig">The scheduler config, e.g. <see cref="SchedulerConfig.Default"/>.</param>
+        /// <param name="device">The device to run on.</param>
+        public ContinuousBatchingPipeline(string modelPath, SchedulerConfig schedulerConfig, string device = "CPU")
+        {
+            if (modelPath is null)
+                throw new ArgumentNullException(nameof(modelPath));
+            if (device is null)
+                throw new ArgumentNullException(nameof(device));
+            HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_create_with_scheduler_device(
+                out ContinuousBatchingPipelineHandle pipeline, modelPath, ref schedulerConfig, device));
+            handle = pipeline;
+        }
+
+        /// <summary>
+        /// Constructs a pipeline decoding speculatively with a draft model, which shares the scheduler config.
+        /// The <see cref="GenerationConfig.NumAssistantTokens"/> or
+        /// <see cref="GenerationConfig.AssistantConfidenceThreshold"/> of each request selects how many tokens the
+        /// draft model proposes per step.
+        /// </summary>
+        /// <param name="modelPath">The model directory.</param>
+        /// <param name="schedulerConfig">The scheduler config.</param>
+        /// <param name="device">The device to run the model on.</param>
+        /// <param name="draftModelPath">The directory of the draft model, sharing the tokenizer of the model.</param>
+        /// <param name="draftDevice">The device to run the draft model on.</param>
+        public ContinuousBatchingPipeline(string modelPath, SchedulerConfig schedulerConfig, string device,
+            string draftModelPath, string draftDevice = "CPU")
+        {
+            if (modelPath is null)
+                throw new ArgumentNullException(nameof(modelPath));
+            if (device is null)
+                throw new ArgumentNullException(nameof(device));
+            if (draftModelPath is null)
+                throw new ArgumentNullException(nameof(draftModelPath));
+            if (draftDevice is null)
+                throw new ArgumentNullException(nameof(draftDevice));
+            HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_create_with_draft_model(
+                out ContinuousBatchingPipelineHandle pipeline, modelPath, ref schedulerConfig, device, draftModelPath,
+                draftDevice));
+            handle = pipeline;
+        }
+
+        /// <summary>
+        /// Constructs the pipeline, decoding speculatively by prompt lookup when asked to, without a draft model.
+        /// The <see cref="GenerationConfig.NumAssistantTokens"/> and <see cref="GenerationConfig.MaxNgramSize"/> of
+        /// each request select how many tokens following the match of its latest n-gram in its prompt are proposed.
+        /// </summary>
+        /// <param name="modelPath">The model directory.</param>
+        /// <param name="schedulerConfig">The scheduler config.</param>
+        /// <param name="device">The device to run on.</param>
+        /// <param name="promptLookup">Whether to decode by prompt lookup.</param>
+        public ContinuousBatchingPipeline(string modelPath, SchedulerConfig schedulerConfig, string device,
+            bool promptLookup)
+        {
+            if (modelPath is null)
+                throw new ArgumentNullException(nameof(modelPath));
+            if (device is null)
+                throw new ArgumentNullException(nameof(device));
+            ContinuousBatchingPipelineHandle pipeline;
+            if (promptLookup)
+                HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_create_with_prompt_lookup(
+                    out pipeline, modelPath, ref schedulerConfig, device));
+            else
+                HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_create_with_scheduler_device(
+                    out pipeline, modelPath, ref schedulerConfig, device));
+            handle = pipeline;
+        }
+
+        /// <summary>
+        /// The native pipeline.
+        /// </summary>
+        public ContinuousBatchingPipelineHandle Handle => handle;
+
+        /// <summary>
+        /// The number of chunks buffered per request. When a reader falls behind by this much, the text of
+        /// its request stays in the native handle until it catches up, the other requests go on.
+        /// </summary>
+        public int StreamCapacity { get; set; } = 64;
+
+        /// <summary>
+        /// The number of requests the pipeline holds at most, 0 for no limit. A request added to a full pipeline
+        /// waits for a step to make room.
+        /// </summary>
+        public int MaxRequests { get; set; }
+
+        /// <summary>
+        /// How long a request waiting for room waits at most before it tries again, in case no step comes.
+        /// </summary>
+        public TimeSpan QueueFullRetryDelay { get; set; } = TimeSpan.FromMilliseconds(50);
+
+        /// <summary>
+        /// Gets the default generation config of the pipeline.
+        /// </summary>
+        /// <returns>The config, dispose it after use.</returns>
+        public GenerationConfig GetConfig()
+        {
+            HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_get_config(handle,
+                out GenerationConfigHandle config));
+            return new GenerationConfig(config);
+        }
+
+        /// <summary>
+        /// Sets the admission control. Once set, a request over one of its limits, or over
+        /// <see cref="MaxRequests"/>, fails fast with <see cref="RequestRejectedException"/> instead of waiting,
+        /// so the load can go to another replica.
+        /// </summary>
+        /// <param name="config">The limits, null to admit every request.</param>
+        public void SetAdmissionConfig(AdmissionConfig? config)
+        {
+            if (config is AdmissionConfig value)
+                HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_set_admission_config(handle,
+                    ref value));
+            else
+                HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_set_admission_config(handle,
+                    IntPtr.Zero));
+            admissionControl = config is not null;
+        }
+
+        /// <summary>
+        /// Gets the load seen by the admission control and the suggested retry-after.
+        /// </summary>
+        public AdmissionState GetAdmissionState()
+        {
+            HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_get_admission_state(handle,
+                out AdmissionState state));
+            return state;
+        }
+
+        /// <summary>
+        /// Sets the completion cache of the pipeline. A greedy request whose prompt and config were
+        /// seen in a request which finished before is not run again, its text is streamed from the tokens kept.
+        /// Such a request takes no room, it is not subject to <see cref="MaxRequests"/> or the admission control.
+        /// </summary>
+        /// <param name="config">The bounds of the cache, null to remove it.</param>
+        public void SetCompletionCache(CompletionCacheConfig? config)
+        {
+            if (config is CompletionCacheConfig value)
+                HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_set_completion_cache(handle, ref value));
+            else
+                HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_set_completion_cache(handle, IntPtr.Zero));
+        }
+
+        /// <summary>
+        /// Gets the counters of the completion cache of the pipeline, all 0 without one.
+        /// </summary>
+        public CompletionCacheStats GetCompletionCacheStats()
+        {
+            HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_get_completion_cache_stats(handle,
+                out CompletionCacheStats stats));
+            return stats;
+        }
+
+        /// <summary>
+        /// Keeps the tokens of a prompt prefix shared by many requests, a long system message for instance, in a
+        /// snapshot file for <see cref="RestorePrefixSnapshots"/> to prefill after a restart.
+        /// </summary>
+        /// <param name="path">The snapshot file, created when it does not exist.</param>
+        /// <param name="modelId">The model the prefix is kept for.</param>
+        /// <param name="prefix">The prefix, ending where the prompts sharing it go on with other text.</param>
+        public void SavePrefixSnapshot(string path, string modelId, string prefix)
+        {
+            HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_save_prefix_snapshot(handle,
+                StructCommon.StringToUtf8(path), StructCommon.StringToUtf8(modelId), StructCommon.StringToUtf8(prefix)));
+        }
+
+        /// <summary>
+        /// Prefills the prefixes a snapshot file keeps for a model, so that the first requests sharing them skip
+        /// their prefill. It only helps a pipeline created with prefix caching enabled in its
+        /// <see cref="SchedulerConfig"/>. The call steps the pipeline itself, make it before the first
+        /// <see cref="AddRequestAsync(string, GenerationConfig, CancellationToken)"/>.
+        /// </summary>
+        /// <param name="path">The snapshot file, a missing one holds no prefix.</param>
+        /// <param name="modelId">The model the prefixes were kept for.</param>
+        /// <returns>The number of prefixes prefilled.</returns>
+        /// <exception cref="InvalidOperationException">The step loop of the requests is running.</exception>
+        public ulong RestorePrefixSnapshots(string path, string modelId)
+        {
+            // holding the lock keeps the step loop from starting while the prefills step the pipeline
+            lock (syncLock)
+            {
+                if (loop != null)
+                    throw new InvalidOperationException("Restore the prefix snapshots before adding requests.");
+                HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_restore_prefix_snapshots(
+                    handle, StructCommon.StringToUtf8(path), StructCommon.StringToUtf8(modelId), out UIntPtr restored));
+                return restored.ToUInt64();
+            }
+        }
+
+        /// <summary>
+        /// Sets the bounds of the chat sessions of <see cref="AddSessionRequestAsync"/>. Without a call the sessions
+        /// have no bound. <see cref="ChatSessionsConfig.IdleMs"/> is not used, the prefix cache of the pipeline
+        /// evicts the blocks of idle sessions by itself.
+        /// </summary>
+        /// <param name="config">The bounds, null to forget every session.</param>
+        public void SetChatSessions(ChatSessionsConfig? config)
+        {
+            if (config is ChatSessionsConfig value)
+                HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_set_chat_sessions(handle,
+                    ref value));
+            else
+                HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_set_chat_sessions(handle,
+                    IntPtr.Zero));
+        }
+
+        /// <summary>
+        /// Forgets a chat session and its snapshot file.
+        /// </summary>
+        /// <param name="sessionId">The id of the session.</param>
+        public void EndSession(string sessionId)
+        {
+            if (sessionId is null)
+                throw new ArgumentNullException(nameof(sessionId));
+            HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_end_session(handle,
+                StructCommon.StringToUtf8(sessionId)));
+        }
+
+        /// <summary>
+        /// Gets the counters of the chat sessions. A turn with a history counts as a re-prefill, whether the prefix
+        /// cache served it or not.
+        /// </summary>
+        public ChatSessionsStats GetChatSessionsStats()
+        {
+            HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_get_chat_sessions_stats(handle,
+                out ChatSessionsStats stats));
+            return stats;
+        }
+
+        /// <summary>
+        /// Turns the coalescing of identical requests on or off. While it is on, a greedy request added by
+        /// <see cref="AddRequestAsync(string, GenerationConfig, CancellationToken)"/> with the prompt and config of
+        /// a request in flight joins it: the model decodes it once and every caller streams all of its text.
+        /// A joined request takes no room, it is not subject to <see cref="MaxRequests"/> or the admission control.
+        /// </summary>
+        /// <param name="enable">Whether to coalesce the requests added from now on.</param>
+        public void SetRequestCoalescing(bool enable)
+        {
+            HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_set_request_coalescing(handle,
+                enable ? 1 : 0));
+        }
+
+        /// <summary>
+        /// The number of requests served by joining an identical one since coalescing was turned on.
+        /// </summary>
+        public ulong CoalescedRequests
+        {
+            get
+            {
+                HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_get_coalesced_requests(
+                    handle, out ulong count));
+                return count;
+            }
+        }
+
+        /// <summary>
+        /// Sets the limits of the request scheduler, which holds the requests added with <see cref="RequestOptions"/>
+        /// until they fit.
+        /// </summary>
+        /// <param name="config">The limits.</param>
+        public void SetRequestSchedulerConfig(RequestSchedulerConfig config)
+        {
+            HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_set_request_scheduler_config(
+                handle, ref config));
+        }
+
+        /// <summary>
+        /// Sets the weight of a tenant. While tenants compete for the room left by
+        /// <see cref="SetRequestSchedulerConfig"/>, each is served tokens in proportion to its weight, 1 until set.
+        /// </summary>
+        /// <param name="tenant">The tenant, null for the default tenant.</param>
+        /// <param name="weight">The weight, greater than 0.</param>
+        public void SetTenantWeight(string tenant, float weight)
+        {
+            if (!(weight > 0))
+                throw new ArgumentOutOfRangeException(nameof(weight));
+            HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_set_tenant_weight(handle,
+                tenant is null ? null : StructCommon.StringToUtf8(tenant), weight));
+        }
+
+        /// <summary>
+        /// Gets the queue depth, tokens served and latencies of a tenant.
+        /// </summary>
+        /// <param name="tenant">The tenant, null for the default tenant.</param>
+        public TenantMetrics GetTenantMetrics(string tenant)
+        {
+            HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_get_tenant_metrics(handle,
+                tenant is null ? null : StructCommon.StringToUtf8(tenant), out TenantMetrics metrics));
+            return metrics;
+        }
+
+        /// <summary>
+        /// Adds a request to the batch, streaming its text as it is decoded.
+        /// </summary>
+        /// <remarks>
+        /// Cancelling the token, or leaving the enumeration early, drops the request from the batch. When the
+        /// pipeline holds <see cref="MaxRequests"/> requests the call waits for room before adding it, unless
+        /// an admission control is set, see <see cref="SetAdmissionConfig"/>.
+        /// </remarks>
+        /// <param name="prompt">The prompt.</param>
+        /// <param name="config">The generation config, null for the config of the pipeline.</param>
+        /// <param name="cancellationToken">Drops the request.</param>
+        /// <returns>The text chunks in order.</returns>
+        /// <exception cref="RequestRejectedException">The admission control rejected the request.</exception>
+        public IAsyncEnumerable<TokenChunk> AddRequestAsync(string prompt, GenerationConfig config = null,
+            CancellationToken cancellationToken = default)
+        {
+            return AddAsync(prompt, null, null, config, cancellationToken);
+        }
+
+        /// <summary>
+        /// Adds a request to the request scheduler, which releases it into the batch by priority, then by the share
+        /// of its tenant, then by deadline, streaming its text as it is decoded.
+        /// </summary>
+        /// <remarks>
+        /// The request waits in the scheduler instead of in <see cref="MaxRequests"/> or the admission control,
+        /// see <see cref="SetRequestSchedulerConfig"/>. Cancelling the token, or leaving the enumeration early,
+        /// drops the request, from the queue or from the batch.
+        /// </remarks>
+        /// <param name="prompt">The prompt.</param>
+        /// <param name="options">The priority and deadline of the request.</param>
+        /// <param name="config">The generation config, null for the config of the pipeline.</param>
+        /// <param name="cancellationToken">Drops the request.</param>
+        /// <returns>The text chunks in order.</returns>
+        public IAsyncEnumerable<TokenChunk> AddRequestAsync(string prompt, RequestOptions options,
+            GenerationConfig config = null, CancellationToken cancellationToken = default)
+        {
+            return AddAsync(prompt, options, null, config, cancellationToken);
+        }
+
+        /// <summary>
+        /// Adds a turn of a chat session, created on its first turn, streaming its text as it is decoded. The answer
+        /// joins the history of the session once it has been read whole, the turns of one session go one at a time.
+        /// </summary>
+        /// <remarks>
+        /// Each turn prefills the whole history of its session, which the prefix cache of the pipeline serves when
+        /// it still holds its blocks. The request waits for room as the ones of
+        /// <see cref="AddRequestAsync(string, GenerationConfig, CancellationToken)"/>.
+        /// </remarks>
+        /// <param name="sessionId">The id of the session.</param>
+        /// <param name="prompt">The message of the turn.</param>
+        /// <param name="config">The generation config, null for the config of the pipeline.</param>
+        /// <param name="cancellationToken">Drops the request.</param>
+        /// <returns>The text chunks in order.</returns>
+        /// <exception cref="RequestRejectedException">The admission control rejected the request.</exception>
+        public IAsyncEnumerable<TokenChunk> AddSessionRequestAsync(string sessionId, string prompt,
+            GenerationConfig config = null, CancellationToken cancellationToken = default)
+        {
+            if (sessionId is null)
+                throw new ArgumentNullException(nameof(sessionId));
+            return AddAsync(prompt, null, sessionId, config, cancellationToken);
+        }
+
+        private async IAsyncEnumerable<TokenChunk> AddAsync(string prompt, RequestOptions? options, string sessionId,
+            GenerationConfig config, [EnumeratorCancellation] CancellationToken cancellationToken)
+        {
+            if (prompt is null)
+                throw new ArgumentNullException(nameof(prompt));
+            cancellationToken.ThrowIfCancellationRequested();
+
+            StreamingRequest request;
+            while (true)
+            {
+                // taken before the attempt, so a step right after it is not missed
+                Task roomSignal = Volatile.Read(ref stepped).Task;
+                request = TryAdd(prompt, options, sessionId, config, cancellationToken);
+                if (request is not null)
+                    break;
+                if (admissionControl)
+                    throw new RequestRejectedException(GetAdmissionState());
+                await Task.WhenAny(roomSignal, Task.Delay(QueueFullRetryDelay, cancellationToken)).ConfigureAwait(false);
+                cancellationToken.ThrowIfCancellationRequested();
+            }
+            using CancellationTokenRegistration registration = cancellationToken.Register(
+                state => ((StreamingRequest)state!).Drop(), request);
+            bool completed = false;
+            try
+            {
+                await foreach (TokenChunk chunk in request.Stream.ReadAllAsync(cancellationToken).ConfigureAwait(false))
+                    yield return chunk;
+                completed = true;
+            }
+            finally
+            {
+                // the loop releases the request and its streamer once the native side lets go of it
+                if (!completed)
+                    request.Drop();
+            }
+        }
+
+        /// <summary>
+        /// Adds a request, or returns null when the pipeline holds <see cref="MaxRequests"/> requests. A request
+        /// with options always goes to the request scheduler, one with a session id is a turn of that session.
+        /// </summary>
+        private StreamingRequest TryAdd(string prompt, RequestOptions? options, string sessionId,
+            GenerationConfig config, CancellationToken cancellationToken)
+        {
+            byte[] inputs = StructCommon.StringToUtf8(prompt);
+            var stream = new TextStreamChannel(StreamCapacity, false, cancellationToken);
+            GenerationConfig defaultConfig = null;
+            try
+            {
+                if (config is null)
+                    defaultConfig = GetConfig();
+                Streamer streamer = stream.Native;
+                ulong requestId = (ulong)Interlocked.Increment(ref nextRequestId);
+                GenerationHandleSafeHandle generation;
+                TryStatus added = TryStatus.OK;
+                if (options is RequestOptions value)
+                    HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_add_request_with_options(
+                        handle, requestId, inputs, (config ?? defaultConfig)!.Handle, ref streamer, ref value,
+                        out generation));
+                else if (sessionId is not null)
+                    HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_try_add_session_request(
+                        handle, requestId, StructCommon.StringToUtf8(sessionId), inputs, (config ?? defaultConfig)!.Handle,
+                        ref streamer, (UIntPtr)(uint)Math.Max(MaxRequests, 0), out generation, out added));
+                else
+                    HandleException.handler(NativeMethods.ov_genai_continuous_batching_pipeline_try_add_request(handle,
+                        requestId, inputs, (config ?? defaultConfig)!.Handle, ref streamer,
+                        (UIntPtr)(uint)Math.Max(MaxRequests, 0), out generation, out added));
+                if (added == TryStatus.QUEUE_FULL)
+                {
+                    generation.Dispose();
+                    stream.Dispose();
+                    return null;
+                }
+                var request = new StreamingRequest(generation, stream);
+                lock (syncLock)
+                {
+                    requests.Add(request);
+                    loop ??= Task.Factory.StartNew(Run, CancellationToken.None, TaskCreationOptions.LongRunning,
+                        TaskScheduler.Default);
+                }
+                wake.Set();
+                return request;
+            }
+            catch
+            {
+                stream.Dispose();
+                throw;
+            }
+            finally
+            {
+                defaultConfig?.Dispose();
+            }
+        }
+
+        private void Run()
+        {
+            var finished = new List<StreamingRequest>();
+            while (true)
+            {
+                StreamingRequest[] active;
+                lock (syncLock)
+                {
+                    if (requests.Count == 0)
+                    {
+                        loop = null;
+                        return;
+                    }
+                    active = requests.ToArray();
+                }
+
+#if NET7_0_OR_GREATER
+                Exception stepError = ToException(BlittableNativeMethods.ov_genai_continuous_batching_pipeline_try_step(
+                    handle, out TryStatus stepStatus));
+#else
+                Exception stepError = ToException(NativeMethods.ov_genai_continuous_batching_pipeline_try_step(handle,
+                    out TryStatus stepStatus));
+#endif
+                if (stepStatus == TryStatus.OK)
+                    Interlocked.Exchange(ref stepped, NewStepSignal()).TrySetResult(true);
+                bool progressed = false;
+                foreach (StreamingRequest request in active)
+                {
+                    if (stepError is not null)
+                    {
+                        request.Stream.Complete(stepError);
+                        finished.Add(request);
+                        continue;
+                    }
+                    if (request.Finished)
+                    {
+                        // a dropped request has no reader left to hand the rest over to
+                        if (request.Stream.Complete() || request.Stream.IsCancelled)
+                            finished.Add(request);
+                        continue;
+                    }
+                    if (!request.Stream.HasRoom())
+                        continue;
+#if NET7_0_OR_GREATER
+                    ExceptionStatus status = BlittableNativeMethods.ov_genai_generation_handle_stream(
+                        request.Generation, out int done);
+#else
+                    ExceptionStatus status = NativeMethods.ov_genai_generation_handle_stream(request.Generation,
+                        out int done);
+#endif
+                    progressed = true;
+                    if (status != ExceptionStatus.OK)
+                    {
+                        // reading a request dropped by its reader may fail, that reader is gone anyway
+                        request.Stream.Complete(request.Stream.IsCancelled ? null : ToException(status));
+                        finished.Add(request);
+                    }
+                    else if (done != 0)
+                    {
+                        request.Finished = true;
+                        if (request.Stream.Complete() || request.Stream.IsCancelled)
+                            finished.Add(request);
+                    }
+                }
+
+                if (finished.Count > 0)
+                {
+                    lock (syncLock)
+                    {
+                        foreach (StreamingRequest request in finished)
+                            requests.Remove(request);
+                    }
+                    foreach (StreamingRequest request in finished)
+                    {
+                        request.Generation.Dispose();
+                        request.Stream.Dispose();
+                    }
+                    finished.Clear();
+                }
+
+                if (!progressed && stepError is null)
+                {
+                    // every request waits for its reader, or the step had nothing to run
+                    wake.Wait(TimeSpan.FromMilliseconds(5));
+                    wake.Reset();
+                }
+            }
+        }
+
+        private static TaskCompletionSource<bool> NewStepSignal()
+        {
+            return new TaskCompletionSource<bool>(TaskCreationOptions.RunContinuationsAsynchronously);
+        }
+
+        private static Exception ToException(ExceptionStatus status)
+        {
+            try
+            {
+                HandleException.handler(status);
+                return null;
+            }
+            catch (Exception e)
+            {
+                return e;
+            }
+        }
+
+        /// <summary>
+        /// Releases the native pipeline, after the requests still running have been dropped.
+        /// </summary>
+        public void Dispose()
+        {
+            Task running;
+            lock (syncLock)
+            {
+                foreach (StreamingRequest request in requests)
+                    request.Drop();
+                running = loop;
+            }
+            running?.Wait();
+            handle.Dispose();
+            wake.Dispose();
+        }
+    }
+}
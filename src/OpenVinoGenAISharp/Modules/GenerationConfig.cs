@@ -0,0 +1,285 @@
+﻿using System;
+using System.Runtime.InteropServices;
+using System.Text;
+using OpenVinoSharp.GenAI.Internal;
+
+namespace OpenVinoSharp.GenAI
+{
+    /// <summary>
+    /// ov::genai::GenerationConfig, the sampling parameters of a generation.
+    /// </summary>
+    public sealed class GenerationConfig : IDisposable
+    {
+        /// <summary>
+        /// Creates the default configuration.
+        /// </summary>
+        public GenerationConfig()
+        {
+            HandleException.handler(NativeMethods.ov_genai_generation_config_create(out GenerationConfigHandle handle));
+            Handle = handle;
+        }
+
+        /// <summary>
+        /// Reads the configuration from a generation_config.json.
+        /// </summary>
+        /// <param name="jsonPath">The path of the file.</param>
+        public GenerationConfig(string jsonPath)
+        {
+            if (jsonPath is null)
+                throw new ArgumentNullException(nameof(jsonPath));
+            HandleException.handler(NativeMethods.ov_genai_generation_config_create_with_json(jsonPath,
+                out GenerationConfigHandle handle));
+            Handle = handle;
+        }
+
+        /// <summary>
+        /// Takes ownership of a native configuration.
+        /// </summary>
+        /// <param name="handle">The handle.</param>
+        public GenerationConfig(GenerationConfigHandle handle)
+        {
+            Handle = handle ?? throw new ArgumentNullException(nameof(handle));
+        }
+
+        /// <summary>
+        /// The native configuration.
+        /// </summary>
+        public GenerationConfigHandle Handle { get; }
+
+        /// <summary>
+        /// The minimum number of tokens to generate, the stop conditions are ignored before it.
+        /// </summary>
+        public ulong MinNewTokens
+        {
+            get
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_get_min_new_tokens(Handle,
+                    out UIntPtr value));
+                return value.ToUInt64();
+            }
+            set
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_set_min_new_tokens(Handle,
+                    new UIntPtr(value)));
+            }
+        }
+
+        /// <summary>
+        /// The strings that stop the generation once the output ends with one of them. They are matched natively
+        /// at every step, so the generation ends on the step that completes one.
+        /// </summary>
+        public string[] StopStrings
+        {
+            get
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_get_stop_strings(Handle,
+                    out IntPtr block, out UIntPtr size));
+                try
+                {
+                    byte[] bytes = new byte[checked((int)size.ToUInt64())];
+                    Marshal.Copy(block, bytes, 0, bytes.Length);
+                    // the strings follow each other, each one NUL terminated
+                    string[] strings = Encoding.UTF8.GetString(bytes).Split('\0');
+                    Array.Resize(ref strings, strings.Length - 1);
+                    return strings;
+                }
+                finally
+                {
+                    NativeMethods.ov_genai_free(block);
+                }
+            }
+            set
+            {
+                if (value is null)
+                    throw new ArgumentNullException(nameof(value));
+                StringArray strings = StructCommon.StringArrayToStruct(value);
+                try
+                {
+                    HandleException.handler(NativeMethods.ov_genai_generation_config_set_stop_strings(Handle,
+                        strings.Data, new UIntPtr(strings.Size)));
+                }
+                finally
+                {
+                    StructCommon.FreeStringArray(strings);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Whether the stop string which ended the generation is kept at the end of the output.
+        /// </summary>
+        public bool IncludeStopStrInOutput
+        {
+            get
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_get_include_stop_str_in_output(Handle,
+                    out bool value));
+                return value;
+            }
+            set
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_set_include_stop_str_in_output(Handle,
+                    value));
+            }
+        }
+
+        /// <summary>
+        /// The tokens that stop the generation, in addition to the end of sentence token.
+        /// </summary>
+        public long[] StopTokenIds
+        {
+            get
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_get_stop_token_ids(Handle, null,
+                    UIntPtr.Zero, out UIntPtr size));
+                long[] tokens = new long[checked((int)size.ToUInt64())];
+                if (tokens.Length > 0)
+                    HandleException.handler(NativeMethods.ov_genai_generation_config_get_stop_token_ids(Handle, tokens,
+                        new UIntPtr((ulong)tokens.Length), out size));
+                return tokens;
+            }
+            set
+            {
+                if (value is null)
+                    throw new ArgumentNullException(nameof(value));
+                HandleException.handler(NativeMethods.ov_genai_generation_config_set_stop_token_ids(Handle, value,
+                    new UIntPtr((ulong)value.Length)));
+            }
+        }
+
+        /// <summary>
+        /// The number of top log probabilities returned for each generated token, 0 for none.
+        /// </summary>
+        public ulong Logprobs
+        {
+            get
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_get_logprobs(Handle,
+                    out UIntPtr value));
+                return value.ToUInt64();
+            }
+            set
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_set_logprobs(Handle,
+                    new UIntPtr(value)));
+            }
+        }
+
+        /// <summary>
+        /// The penalty subtracted from the logit of every token already generated, 0 for none.
+        /// </summary>
+        public float PresencePenalty
+        {
+            get
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_get_presence_penalty(Handle,
+                    out float value));
+                return value;
+            }
+            set
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_set_presence_penalty(Handle, value));
+            }
+        }
+
+        /// <summary>
+        /// The penalty subtracted from the logit of a token for every time it was generated, 0 for none.
+        /// </summary>
+        public float FrequencyPenalty
+        {
+            get
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_get_frequency_penalty(Handle,
+                    out float value));
+                return value;
+            }
+            set
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_set_frequency_penalty(Handle, value));
+            }
+        }
+
+        /// <summary>
+        /// The seed of the random generator of multinomial sampling, to make sampled outputs reproducible.
+        /// </summary>
+        public ulong RngSeed
+        {
+            get
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_get_rng_seed(Handle,
+                    out UIntPtr value));
+                return value.ToUInt64();
+            }
+            set
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_set_rng_seed(Handle,
+                    new UIntPtr(value)));
+            }
+        }
+
+        /// <summary>
+        /// The number of tokens the draft model proposes per step of a pipeline created with one,
+        /// 0 to use <see cref="AssistantConfidenceThreshold"/> instead.
+        /// </summary>
+        public ulong NumAssistantTokens
+        {
+            get
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_get_num_assistant_tokens(Handle,
+                    out UIntPtr value));
+                return value.ToUInt64();
+            }
+            set
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_set_num_assistant_tokens(Handle,
+                    new UIntPtr(value)));
+            }
+        }
+
+        /// <summary>
+        /// The probability below which the draft model stops proposing tokens, used when
+        /// <see cref="NumAssistantTokens"/> is 0.
+        /// </summary>
+        public float AssistantConfidenceThreshold
+        {
+            get
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_get_assistant_confidence_threshold(
+                    Handle, out float value));
+                return value;
+            }
+            set
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_set_assistant_confidence_threshold(
+                    Handle, value));
+            }
+        }
+
+        /// <summary>
+        /// The longest n-gram of the prompt a pipeline with prompt lookup matches against the end of the output,
+        /// the tokens following the match are proposed, up to <see cref="NumAssistantTokens"/>.
+        /// </summary>
+        public ulong MaxNgramSize
+        {
+            get
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_get_max_ngram_size(Handle,
+                    out UIntPtr value));
+                return value.ToUInt64();
+            }
+            set
+            {
+                HandleException.handler(NativeMethods.ov_genai_generation_config_set_max_ngram_size(Handle,
+                    new UIntPtr(value)));
+            }
+        }
+
+        /// <summary>
+        /// Releases the native configuration.
+        /// </summary>
+        public void Dispose()
+        {
+            Handle.Dispose();
+        }
+    }
+}
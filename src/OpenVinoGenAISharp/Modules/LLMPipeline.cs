@@ -0,0 +1,544 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Threading;
+using System.Threading.Tasks;
+using OpenVinoSharp.GenAI.Internal;
+
+namespace OpenVinoSharp.GenAI
+{
+    /// <summary>
+    /// ov::genai::LLMPipeline, text generation with one request at a time.
+    /// </summary>
+    public sealed class LLMPipeline : IDisposable
+    {
+        private readonly LLMPipelineHandle handle;
+        // the native pipeline runs one generation at a time
+        private readonly SemaphoreSlim generateLock = new(1, 1);
+
+        /// <summary>
+        /// Constructs the pipeline from the model, tokenizer and generation_config.json in one directory.
+        /// </summary>
+        /// <param name="modelPath">The model directory.</param>
+        /// <param name="device">The device to run on.</param>
+        public LLMPipeline(string modelPath, string device = "CPU")
+        {
+            if (modelPath is null)
+                throw new ArgumentNullException(nameof(modelPath));
+            if (device is null)
+                throw new ArgumentNullException(nameof(device));
+            HandleException.handler(NativeMethods.ov_genai_llm_pipeline_create_with_model_path(modelPath, device,
+                out LLMPipelineHandle pipeline));
+            handle = pipeline;
+        }
+
+        /// <summary>
+        /// Constructs a pipeline decoding speculatively: a smaller draft model proposes tokens which the model
+        /// validates in one inference. <see cref="GenerationConfig.NumAssistantTokens"/> or
+        /// <see cref="GenerationConfig.AssistantConfidenceThreshold"/> selects how many it proposes per step.
+        /// </summary>
+        /// <param name="modelPath">The model directory.</param>
+        /// <param name="device">The device to run the model on.</param>
+        /// <param name="draftModelPath">The directory of the draft model, sharing the tokenizer of the model.</param>
+        /// <param name="draftDevice">The device to run the draft model on.</param>
+        public LLMPipeline(string modelPath, string device, string draftModelPath, string draftDevice = "CPU")
+        {
+            if (modelPath is null)
+                throw new ArgumentNullException(nameof(modelPath));
+            if (device is null)
+                throw new ArgumentNullException(nameof(device));
+            if (draftModelPath is null)
+                throw new ArgumentNullException(nameof(draftModelPath));
+            if (draftDevice is null)
+                throw new ArgumentNullException(nameof(draftDevice));
+            HandleException.handler(NativeMethods.ov_genai_llm_pipeline_create_with_draft_model(modelPath, device,
+                draftModelPath, draftDevice, out LLMPipelineHandle pipeline));
+            handle = pipeline;
+        }
+
+        /// <summary>
+        /// Constructs the pipeline, decoding speculatively by prompt lookup when asked to: the tokens which followed
+        /// the latest n-gram of the output in the prompt are proposed and validated in one inference, without a draft
+        /// model. Set <see cref="GenerationConfig.NumAssistantTokens"/> and <see cref="GenerationConfig.MaxNgramSize"/>
+        /// in the configs of its generations.
+        /// </summary>
+        /// <param name="modelPath">The model directory.</param>
+        /// <param name="device">The device to run on.</param>
+        /// <param name="promptLookup">Whether to decode by prompt lookup.</param>
+        public LLMPipeline(string modelPath, string device, bool promptLookup)
+        {
+            if (modelPath is null)
+                throw new ArgumentNullException(nameof(modelPath));
+            if (device is null)
+                throw new ArgumentNullException(nameof(device));
+            LLMPipelineHandle pipeline;
+            if (promptLookup)
+                HandleException.handler(NativeMethods.ov_genai_llm_pipeline_create_with_prompt_lookup(modelPath, device,
+                    out pipeline));
+            else
+                HandleException.handler(NativeMethods.ov_genai_llm_pipeline_create_with_model_path(modelPath, device,
+                    out pipeline));
+            handle = pipeline;
+        }
+
+        /// <summary>
+        /// The native pipeline.
+        /// </summary>
+        public LLMPipelineHandle Handle => handle;
+
+        /// <summary>
+        /// The number of chunks buffered between the generating thread and the reader. When the reader
+        /// falls behind by this much the generation waits.
+        /// </summary>
+        public int StreamCapacity { get; set; } = 64;
+
+        /// <summary>
+        /// Sets the completion cache of the pipeline. A greedy generation outside of a chat whose
+        /// prompt and config were seen in a generation which ran to its end is not run again, the text kept is
+        /// returned, or streamed in one chunk.
+        /// </summary>
+        /// <param name="config">The bounds of the cache, null to remove it.</param>
+        public void SetCompletionCache(CompletionCacheConfig? config)
+        {
+            if (config is CompletionCacheConfig value)
+                HandleException.handler(NativeMethods.ov_genai_llm_pipeline_set_completion_cache(handle, ref value));
+            else
+                HandleException.handler(NativeMethods.ov_genai_llm_pipeline_set_completion_cache(handle, IntPtr.Zero));
+        }
+
+        /// <summary>
+        /// Gets the counters of the completion cache of the pipeline, all 0 without one.
+        /// </summary>
+        public CompletionCacheStats GetCompletionCacheStats()
+        {
+            HandleException.handler(NativeMethods.ov_genai_llm_pipeline_get_completion_cache_stats(handle,
+                out CompletionCacheStats stats));
+            return stats;
+        }
+
+        /// <summary>
+        /// Gets the acceptance counters of the draft model or of the prompt lookup, all 0 for a pipeline constructed
+        /// with neither.
+        /// </summary>
+        /// <returns>The counters.</returns>
+        public SpeculativeMetrics GetSpeculativeMetrics()
+        {
+            HandleException.handler(NativeMethods.ov_genai_llm_pipeline_get_speculative_metrics(handle,
+                out SpeculativeMetrics metrics));
+            return metrics;
+        }
+
+        /// <summary>
+        /// Generates the answer to a prompt, streaming the text as it is decoded.
+        /// </summary>
+        /// <remarks>
+        /// The generation runs on a thread of its own, no thread of the caller is blocked while it runs.
+        /// Cancelling the token, or leaving the enumeration early, stops the generation before its next
+        /// decode step. Calls on one pipeline run one after the other.
+        /// </remarks>
+        /// <param name="prompt">The prompt.</param>
+        /// <param name="config">The generation config, null for the config of the pipeline.</param>
+        /// <param name="cancellationToken">Stops the generation.</param>
+        /// <returns>The text chunks in order.</returns>
+        public async IAsyncEnumerable<TokenChunk> GenerateAsync(string prompt, GenerationConfig config = null,
+            [EnumeratorCancellation] CancellationToken cancellationToken = default)
+        {
+            if (prompt is null)
+                throw new ArgumentNullException(nameof(prompt));
+            byte[] inputs = StructCommon.StringToUtf8(prompt);
+
+            await generateLock.WaitAsync(cancellationToken).ConfigureAwait(false);
+            var stream = new TextStreamChannel(StreamCapacity, true, cancellationToken);
+            Task generation;
+            try
+            {
+                generation = Task.Factory.StartNew(() => Generate(inputs, config, stream), CancellationToken.None,
+                    TaskCreationOptions.LongRunning, TaskScheduler.Default);
+            }
+            catch
+            {
+                stream.Dispose();
+                generateLock.Release();
+                throw;
+            }
+
+            try
+            {
+                await foreach (TokenChunk chunk in stream.ReadAllAsync(cancellationToken).ConfigureAwait(false))
+                    yield return chunk;
+                cancellationToken.ThrowIfCancellationRequested();
+            }
+            finally
+            {
+                // a reader leaving early stops the generation, the streamer is freed once it has returned
+                stream.Cancel();
+                await generation.ConfigureAwait(false);
+                stream.Dispose();
+                generateLock.Release();
+            }
+        }
+
+        /// <summary>
+        /// Generates the answer to a prompt.
+        /// </summary>
+        /// <remarks>
+        /// Cancelling the token stops the generation before its next decode step, the text generated so far
+        /// is dropped and <see cref="OperationCanceledException"/> thrown. Calls on one pipeline run one after
+        /// the other.
+        /// </remarks>
+        /// <param name="prompt">The prompt.</param>
+        /// <param name="config">The generation config, null for the config of the pipeline.</param>
+        /// <param name="cancellationToken">Stops the generation.</param>
+        /// <returns>The generated text.</returns>
+        public string Generate(string prompt, GenerationConfig config = null,
+            CancellationToken cancellationToken = default)
+        {
+            if (prompt is null)
+                throw new ArgumentNullException(nameof(prompt));
+            byte[] inputs = StructCommon.StringToUtf8(prompt);
+
+            generateLock.Wait(cancellationToken);
+            try
+            {
+                DecodedResultsHandle results = null;
+                ExceptionStatus status = WithCancellation(cancellationToken, () =>
+                {
+                    DecodedResultsHandle r;
+#if NET7_0_OR_GREATER
+                    ExceptionStatus generated = config is null
+                        ? BlittableNativeMethods.ov_genai_llm_pipeline_generate_string(handle, inputs, out r)
+                        : BlittableNativeMethods.ov_genai_llm_pipeline_generate_string_with_config(handle, inputs,
+                            config.Handle, out r);
+#else
+                    ExceptionStatus generated = config is null
+                        ? NativeMethods.ov_genai_llm_pipeline_generate_string(handle, inputs, out r)
+                        : NativeMethods.ov_genai_llm_pipeline_generate_string_with_config(handle, inputs, config.Handle,
+                            out r);
+#endif
+                    results = r;
+                    return generated;
+                });
+                using (results)
+                {
+                    cancellationToken.ThrowIfCancellationRequested();
+                    HandleException.handler(status);
+#if NET7_0_OR_GREATER
+                    HandleException.handler(BlittableNativeMethods.ov_genai_decoded_results_get_texts(results!,
+                        out IntPtr texts));
+#else
+                    HandleException.handler(NativeMethods.ov_genai_decoded_results_get_texts(results!,
+                        out IntPtr texts));
+#endif
+                    try
+                    {
+                        return StructCommon.Utf8ToString(texts);
+                    }
+                    finally
+                    {
+                        NativeMethods.ov_genai_free(texts);
+                    }
+                }
+            }
+            finally
+            {
+                generateLock.Release();
+            }
+        }
+
+        /// <summary>
+        /// Starts a chat: the following prompts are the turns of one conversation, answered with its history,
+        /// until <see cref="FinishChat"/>.
+        /// </summary>
+        public void StartChat()
+        {
+            generateLock.Wait();
+            try
+            {
+                HandleException.handler(NativeMethods.ov_genai_llm_pipeline_generate_start_chat(handle));
+            }
+            finally
+            {
+                generateLock.Release();
+            }
+        }
+
+        /// <summary>
+        /// Finishes the chat, started or imported, and drops its history.
+        /// </summary>
+        public void FinishChat()
+        {
+            generateLock.Wait();
+            try
+            {
+                HandleException.handler(NativeMethods.ov_genai_llm_pipeline_generate_finish_chat(handle));
+            }
+            finally
+            {
+                generateLock.Release();
+            }
+        }
+
+        /// <summary>
+        /// Exports the messages of the chat, to page an idle session out or move it to another pipeline of the
+        /// same model with <see cref="ImportChat"/>.
+        /// </summary>
+        /// <returns>The session, in a compact binary form.</returns>
+        public byte[] ExportChat()
+        {
+            generateLock.Wait();
+            try
+            {
+                HandleException.handler(NativeMethods.ov_genai_llm_pipeline_export_chat(handle,
+                    out IntPtr blob, out UIntPtr blobSize));
+                try
+                {
+                    byte[] session = new byte[checked((int)blobSize.ToUInt64())];
+                    Marshal.Copy(blob, session, 0, session.Length);
+                    return session;
+                }
+                finally
+                {
+                    NativeMethods.ov_genai_free(blob);
+                }
+            }
+            finally
+            {
+                generateLock.Release();
+            }
+        }
+
+        /// <summary>
+        /// Makes an exported session the chat of the pipeline, in place of its current one. The pipeline holds no
+        /// KV cache of the imported history, each turn prefills the whole conversation until <see cref="FinishChat"/>.
+        /// </summary>
+        /// <param name="session">A session from <see cref="ExportChat"/>.</param>
+        public void ImportChat(byte[] session)
+        {
+            if (session is null)
+                throw new ArgumentNullException(nameof(session));
+            generateLock.Wait();
+            try
+            {
+                HandleException.handler(NativeMethods.ov_genai_llm_pipeline_import_chat(handle, session,
+                    (UIntPtr)(ulong)session.Length));
+            }
+            finally
+            {
+                generateLock.Release();
+            }
+        }
+
+        /// <summary>
+        /// Sets the bounds of the chat sessions of <see cref="GenerateInSession"/>. Without a call the sessions have
+        /// no bound.
+        /// </summary>
+        /// <param name="config">The bounds, null to forget every session.</param>
+        public void SetChatSessions(ChatSessionsConfig? config)
+        {
+            generateLock.Wait();
+            try
+            {
+                if (config is ChatSessionsConfig value)
+                    HandleException.handler(NativeMethods.ov_genai_llm_pipeline_set_chat_sessions(handle, ref value));
+                else
+                    HandleException.handler(NativeMethods.ov_genai_llm_pipeline_set_chat_sessions(handle, IntPtr.Zero));
+            }
+            finally
+            {
+                generateLock.Release();
+            }
+        }
+
+        /// <summary>
+        /// Answers a turn of a chat session, created on its first turn.
+        /// </summary>
+        /// <remarks>
+        /// The pipeline holds the KV cache of one session, the one of the latest turn. The turn of a session without
+        /// it prefills the whole history again, from memory or from its snapshot file. The sessions take over the
+        /// chat of the pipeline, do not mix them with <see cref="StartChat"/>.
+        /// </remarks>
+        /// <param name="sessionId">The id of the session.</param>
+        /// <param name="prompt">The message of the turn.</param>
+        /// <param name="config">The generation config, null for the config of the pipeline.</param>
+        /// <param name="cancellationToken">Stops the generation.</param>
+        /// <returns>The generated text.</returns>
+        public string GenerateInSession(string sessionId, string prompt, GenerationConfig config = null,
+            CancellationToken cancellationToken = default)
+        {
+            if (sessionId is null)
+                throw new ArgumentNullException(nameof(sessionId));
+            if (prompt is null)
+                throw new ArgumentNullException(nameof(prompt));
+            byte[] id = StructCommon.StringToUtf8(sessionId);
+            byte[] inputs = StructCommon.StringToUtf8(prompt);
+
+            generateLock.Wait(cancellationToken);
+            try
+            {
+                DecodedResultsHandle results = null;
+                ExceptionStatus status = WithCancellation(cancellationToken, () =>
+                {
+                    DecodedResultsHandle r;
+                    ExceptionStatus generated = config is null
+                        ? NativeMethods.ov_genai_llm_pipeline_generate_in_session(handle, id, inputs, IntPtr.Zero,
+                            IntPtr.Zero, out r)
+                        : NativeMethods.ov_genai_llm_pipeline_generate_in_session(handle, id, inputs, config.Handle,
+                            IntPtr.Zero, out r);
+                    results = r;
+                    return generated;
+                });
+                using (results)
+                {
+                    cancellationToken.ThrowIfCancellationRequested();
+                    HandleException.handler(status);
+#if NET7_0_OR_GREATER
+                    HandleException.handler(BlittableNativeMethods.ov_genai_decoded_results_get_texts(results!,
+                        out IntPtr texts));
+#else
+                    HandleException.handler(NativeMethods.ov_genai_decoded_results_get_texts(results!,
+                        out IntPtr texts));
+#endif
+                    try
+                    {
+                        return StructCommon.Utf8ToString(texts);
+                    }
+                    finally
+                    {
+                        NativeMethods.ov_genai_free(texts);
+                    }
+                }
+            }
+            finally
+            {
+                generateLock.Release();
+            }
+        }
+
+        /// <summary>
+        /// Drops the KV cache of the session holding it when it has been idle for longer than
+        /// <see cref="ChatSessionsConfig.IdleMs"/>, its messages stay for its next turn. Call it from a timer.
+        /// </summary>
+        /// <returns>The number of sessions whose KV cache was dropped.</returns>
+        public int EvictIdleSessions()
+        {
+            generateLock.Wait();
+            try
+            {
+                HandleException.handler(NativeMethods.ov_genai_llm_pipeline_evict_idle_sessions(handle,
+                    out UIntPtr evicted));
+                return (int)evicted.ToUInt64();
+            }
+            finally
+            {
+                generateLock.Release();
+            }
+        }
+
+        /// <summary>
+        /// Forgets a chat session, its KV cache and its snapshot file.
+        /// </summary>
+        /// <param name="sessionId">The id of the session.</param>
+        public void EndSession(string sessionId)
+        {
+            if (sessionId is null)
+                throw new ArgumentNullException(nameof(sessionId));
+            generateLock.Wait();
+            try
+            {
+                HandleException.handler(NativeMethods.ov_genai_llm_pipeline_end_session(handle,
+                    StructCommon.StringToUtf8(sessionId)));
+            }
+            finally
+            {
+                generateLock.Release();
+            }
+        }
+
+        /// <summary>
+        /// Gets the counters of the chat sessions, evictions and re-prefills among them.
+        /// </summary>
+        public ChatSessionsStats GetChatSessionsStats()
+        {
+            generateLock.Wait();
+            try
+            {
+                HandleException.handler(NativeMethods.ov_genai_llm_pipeline_get_chat_sessions_stats(handle,
+                    out ChatSessionsStats stats));
+                return stats;
+            }
+            finally
+            {
+                generateLock.Release();
+            }
+        }
+
+        private void Generate(byte[] inputs, GenerationConfig config, TextStreamChannel stream)
+        {
+            try
+            {
+                Streamer streamer = stream.Native;
+                DecodedResultsHandle results = null;
+                ExceptionStatus status = WithCancellation(stream.Token, () =>
+                {
+                    DecodedResultsHandle r;
+                    ExceptionStatus generated = config is null
+                        ? NativeMethods.ov_genai_llm_pipeline_generate_string_with_streamer(handle, inputs,
+                            IntPtr.Zero, ref streamer, out r)
+                        : NativeMethods.ov_genai_llm_pipeline_generate_string_with_streamer(handle, inputs,
+                            config.Handle, ref streamer, out r);
+                    results = r;
+                    return generated;
+                });
+                results?.Dispose();
+                // a stream cancelled before the generation started ends empty, the reader throws for its token
+                if (!stream.IsCancelled)
+                    HandleException.handler(status);
+                stream.Complete();
+            }
+            catch (Exception e)
+            {
+                stream.Complete(e);
+            }
+        }
+
+        /// <summary>
+        /// Runs a generate call with a native cancellation token attached to the pipeline, cancelled along
+        /// with <paramref name="cancellationToken"/>. Called under <see cref="generateLock"/>.
+        /// </summary>
+        private ExceptionStatus WithCancellation(CancellationToken cancellationToken, Func<ExceptionStatus> generate)
+        {
+            if (!cancellationToken.CanBeCanceled)
+                return generate();
+
+            HandleException.handler(NativeMethods.ov_genai_cancellation_token_create(out CancellationTokenHandle token));
+            using (token)
+            {
+                HandleException.handler(NativeMethods.ov_genai_llm_pipeline_set_cancellation_token(handle, token));
+                try
+                {
+                    // disposing the registration waits for a cancel already running
+                    using (cancellationToken.Register(
+                        state => NativeMethods.ov_genai_cancellation_token_cancel((CancellationTokenHandle)state!),
+                        token))
+                    {
+                        return generate();
+                    }
+                }
+                finally
+                {
+                    NativeMethods.ov_genai_llm_pipeline_set_cancellation_token(handle, IntPtr.Zero);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Releases the native pipeline.
+        /// </summary>
+        public void Dispose()
+        {
+            handle.Dispose();
+            generateLock.Dispose();
+        }
+    }
+}
@@ -0,0 +1,104 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace OpenVinoSharp.GenAI
+{
+    /// <summary>
+    /// ov_genai_request_options_t, how the request scheduler of a <see cref="ContinuousBatchingPipeline"/>
+    /// orders a request.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct RequestOptions
+    {
+        /// <summary>
+        /// Requests of higher priority are released first.
+        /// </summary>
+        public int Priority;
+
+        /// <summary>
+        /// Milliseconds from the add by which the request should be released, the earliest first within a
+        /// priority, 0 for none.
+        /// </summary>
+        public ulong DeadlineMs;
+
+        /// <summary>
+        /// The tenant sharing the tokens of the pipeline with the others by its weight, null for the default tenant.
+        /// </summary>
+        [MarshalAs(UnmanagedType.LPUTF8Str)]
+        public string Tenant;
+
+        /// <summary>
+        /// Constructor
+        /// </summary>
+        /// <param name="priority">Requests of higher priority are released first.</param>
+        /// <param name="deadline">By when the request should be released, null for none.</param>
+        /// <param name="tenant">The tenant of the request, null for the default tenant.</param>
+        public RequestOptions(int priority, TimeSpan? deadline = null, string tenant = null)
+        {
+            Priority = priority;
+            DeadlineMs = deadline is TimeSpan value ? (ulong)Math.Max(1, Math.Ceiling(value.TotalMilliseconds)) : 0;
+            Tenant = tenant;
+        }
+    }
+
+    /// <summary>
+    /// ov_genai_tenant_metrics_t, the metrics of one tenant of the request scheduler.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct TenantMetrics
+    {
+        /// <summary>
+        /// Requests of the tenant waiting in the queue.
+        /// </summary>
+        public ulong QueuedRequests;
+
+        /// <summary>
+        /// Requests of the tenant released and still running.
+        /// </summary>
+        public ulong RunningRequests;
+
+        /// <summary>
+        /// Requests of the tenant finished or dropped after their release.
+        /// </summary>
+        public ulong RequestsServed;
+
+        /// <summary>
+        /// Prompt tokens released plus generated tokens read, the share the weight applies to.
+        /// </summary>
+        public ulong TokensServed;
+
+        /// <summary>
+        /// Moving average of the time from the add to the release, in milliseconds.
+        /// </summary>
+        public float AvgQueueMs;
+
+        /// <summary>
+        /// Moving average of the time from the add to the end of the request, in milliseconds.
+        /// </summary>
+        public float AvgLatencyMs;
+    }
+
+    /// <summary>
+    /// ov_genai_request_scheduler_config_t, the limits of the request scheduler of a
+    /// <see cref="ContinuousBatchingPipeline"/>. 0 disables a limit.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct RequestSchedulerConfig
+    {
+        /// <summary>
+        /// Maximum number of released requests still running.
+        /// </summary>
+        public ulong MaxRunningRequests;
+
+        /// <summary>
+        /// KV cache usage in percent from which no request is released.
+        /// </summary>
+        public float MaxCacheUsage;
+
+        /// <summary>
+        /// Whether a running request of lower priority is preempted for the head of the queue when there is no room.
+        /// </summary>
+        [MarshalAs(UnmanagedType.Bool)]
+        public bool Preemption;
+    }
+}
@@ -0,0 +1,31 @@
+﻿using System;
+
+namespace OpenVinoSharp.GenAI
+{
+    /// <summary>
+    /// Thrown when the admission control of a <see cref="ContinuousBatchingPipeline"/> rejects a request.
+    /// </summary>
+    [Serializable]
+    public class RequestRejectedException : Exception
+    {
+        /// <summary>
+        /// Constructor
+        /// </summary>
+        /// <param name="state">The load which led to the rejection.</param>
+        public RequestRejectedException(AdmissionState state)
+            : base($"The request is rejected by the admission control, retry after {state.RetryAfterMs} ms")
+        {
+            State = state;
+        }
+
+        /// <summary>
+        /// The load which led to the rejection.
+        /// </summary>
+        public AdmissionState State { get; }
+
+        /// <summary>
+        /// Suggested wait before the request is sent again, to this replica or another one.
+        /// </summary>
+        public TimeSpan RetryAfter => State.RetryAfter;
+    }
+}
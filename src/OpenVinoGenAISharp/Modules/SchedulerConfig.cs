@@ -0,0 +1,63 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace OpenVinoSharp.GenAI
+{
+    /// <summary>
+    /// ov::genai::SchedulerConfig, passed to the native library as it is laid out in C++.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct SchedulerConfig
+    {
+        /// <summary>
+        /// Maximum number of tokens to batch in one step.
+        /// </summary>
+        public ulong MaxNumBatchedTokens;
+
+        /// <summary>
+        /// Total number of KV blocks, 0 to derive it from <see cref="CacheSize"/>.
+        /// </summary>
+        public ulong NumKvBlocks;
+
+        /// <summary>
+        /// KV cache size in GB.
+        /// </summary>
+        public ulong CacheSize;
+
+        /// <summary>
+        /// Number of tokens in one KV block.
+        /// </summary>
+        public ulong BlockSize;
+
+        /// <summary>
+        /// Whether prompts are split across steps.
+        /// </summary>
+        [MarshalAs(UnmanagedType.U1)]
+        public bool DynamicSplitFuse;
+
+        /// <summary>
+        /// Maximum number of sequences scheduled in one step.
+        /// </summary>
+        public ulong MaxNumSeqs;
+
+        /// <summary>
+        /// Whether KV blocks of common prompt prefixes are reused.
+        /// </summary>
+        [MarshalAs(UnmanagedType.U1)]
+        public bool EnablePrefixCaching;
+
+        /// <summary>
+        /// The defaults of ov::genai::SchedulerConfig.
+        /// </summary>
+        public static SchedulerConfig Default => new SchedulerConfig
+        {
+            MaxNumBatchedTokens = 256,
+            NumKvBlocks = 0,
+            CacheSize = 0,
+            BlockSize = 32,
+            DynamicSplitFuse = true,
+            MaxNumSeqs = 256,
+            EnablePrefixCaching = false,
+        };
+    }
+}
@@ -0,0 +1,49 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace OpenVinoSharp.GenAI
+{
+    /// <summary>
+    /// ov_genai_speculative_metrics_t, the acceptance counters of a pipeline decoding speculatively, with a draft
+    /// model or by prompt lookup.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct SpeculativeMetrics
+    {
+        /// <summary>
+        /// Generations counted.
+        /// </summary>
+        public ulong Generations;
+
+        /// <summary>
+        /// Inferences of the main model, each one validating the draft tokens of the step.
+        /// </summary>
+        public ulong Steps;
+
+        /// <summary>
+        /// Tokens generated.
+        /// </summary>
+        public ulong GeneratedTokens;
+
+        /// <summary>
+        /// Draft tokens proposed, counted for the generations with NumAssistantTokens only. With prompt lookup it
+        /// is the upper bound, a step whose n-gram is not found in the prompt proposes fewer.
+        /// </summary>
+        public ulong DraftTokensProposed;
+
+        /// <summary>
+        /// Draft tokens the main model accepted.
+        /// </summary>
+        public ulong DraftTokensAccepted;
+
+        /// <summary>
+        /// Accepted draft tokens per proposed one, 0 when none was counted.
+        /// </summary>
+        public float AcceptanceRate;
+
+        /// <summary>
+        /// Tokens generated per inference of the main model, 1 without speculation.
+        /// </summary>
+        public float TokensPerStep;
+    }
+}
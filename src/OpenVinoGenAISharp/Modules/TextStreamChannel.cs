@@ -0,0 +1,186 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Text;
+using System.Threading;
+using System.Threading.Channels;
+using OpenVinoSharp.GenAI.Internal;
+
+namespace OpenVinoSharp.GenAI
+{
+    /// <summary>
+    /// Carries the text of a native streamer into a bounded channel read as an async stream.
+    /// </summary>
+    /// <remarks>
+    /// The native side sees a <see cref="Streamer"/> whose user data is a GCHandle of this object. On .NET 5
+    /// and later the callback is an <c>UnmanagedCallersOnly</c> function, older runtimes go through a delegate.
+    /// In blocking mode the callback waits for room in the channel, which holds the generating thread
+    /// back to the pace of the reader. In non-blocking mode, used by the shared step loop of
+    /// <see cref="ContinuousBatchingPipeline"/>, a full channel parks the text in an overflow queue and
+    /// <see cref="HasRoom"/> tells the loop to leave the following tokens in the native handle.
+    /// </remarks>
+    internal sealed class TextStreamChannel : IDisposable
+    {
+#if NET5_0_OR_GREATER
+        // a blittable entry point called without a marshalling thunk, nothing to keep alive
+        private static readonly unsafe IntPtr callbackPointer =
+            (IntPtr)(delegate* unmanaged[Cdecl]<byte*, UIntPtr, IntPtr, byte>)&OnTextUnmanaged;
+#else
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        private delegate bool StreamCallback(IntPtr text, UIntPtr length, IntPtr userData);
+
+        // one delegate for all streams, the stream is found through user data
+        private static readonly StreamCallback callback = OnText;
+        private static readonly IntPtr callbackPointer = Marshal.GetFunctionPointerForDelegate(callback);
+#endif
+
+        private readonly Channel<TokenChunk> channel;
+        private readonly bool blocking;
+        private readonly CancellationTokenSource cancellation;
+        private readonly Queue<TokenChunk> overflow = new();
+        private GCHandle self;
+        private int index;
+
+        /// <summary>
+        /// Constructor
+        /// </summary>
+        /// <param name="capacity">The number of chunks buffered for the reader.</param>
+        /// <param name="blocking">Whether the callback waits for room in the channel.</param>
+        /// <param name="cancellationToken">Stops the stream, the callback then asks the native side to stop.</param>
+        public TextStreamChannel(int capacity, bool blocking, CancellationToken cancellationToken)
+        {
+            if (capacity < 1)
+                throw new ArgumentOutOfRangeException(nameof(capacity));
+            channel = Channel.CreateBounded<TokenChunk>(new BoundedChannelOptions(capacity)
+            {
+                FullMode = BoundedChannelFullMode.Wait,
+                SingleReader = true,
+                SingleWriter = true,
+            });
+            this.blocking = blocking;
+            cancellation = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken);
+            self = GCHandle.Alloc(this);
+        }
+
+        /// <summary>
+        /// The native streamer writing to this channel.
+        /// </summary>
+        public Streamer Native => new Streamer { Callback = callbackPointer, UserData = GCHandle.ToIntPtr(self) };
+
+        /// <summary>
+        /// Whether the stream has been cancelled by the caller or abandoned by the reader.
+        /// </summary>
+        public bool IsCancelled => cancellation.IsCancellationRequested;
+
+        /// <summary>
+        /// Cancelled with the stream.
+        /// </summary>
+        public CancellationToken Token => cancellation.Token;
+
+        /// <summary>
+        /// Moves the overflow into the channel, returns whether there is room for more text.
+        /// </summary>
+        public bool HasRoom()
+        {
+            while (overflow.Count > 0)
+            {
+                if (!channel.Writer.TryWrite(overflow.Peek()))
+                    return false;
+                overflow.Dequeue();
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Ends the stream, with the error the reader receives if any.
+        /// </summary>
+        /// <returns>false while the overflow still waits for room, call it again later.</returns>
+        public bool Complete(Exception error = null)
+        {
+            // the overflow of a finished request is not dropped, the reader gets it before the end
+            if (error is null && !HasRoom())
+                return false;
+            channel.Writer.TryComplete(error);
+            return true;
+        }
+
+        /// <summary>
+        /// Stops the stream, the next callback returns true.
+        /// </summary>
+        public void Cancel()
+        {
+            try
+            {
+                cancellation.Cancel();
+            }
+            catch (ObjectDisposedException)
+            {
+            }
+        }
+
+        /// <summary>
+        /// Reads the chunks until the stream is completed.
+        /// </summary>
+        public async IAsyncEnumerable<TokenChunk> ReadAllAsync(
+            [EnumeratorCancellation] CancellationToken cancellationToken = default)
+        {
+            ChannelReader<TokenChunk> reader = channel.Reader;
+            while (await reader.WaitToReadAsync(cancellationToken).ConfigureAwait(false))
+            {
+                while (reader.TryRead(out TokenChunk chunk))
+                    yield return chunk;
+            }
+        }
+
+        private bool Push(string text)
+        {
+            if (cancellation.IsCancellationRequested)
+                return true;
+            var chunk = new TokenChunk(text, index++);
+            if (overflow.Count == 0 && channel.Writer.TryWrite(chunk))
+                return false;
+            if (!blocking)
+            {
+                overflow.Enqueue(chunk);
+                return false;
+            }
+            // throws when cancelled while waiting, OnText turns that into a stop
+            channel.Writer.WriteAsync(chunk, cancellation.Token).AsTask().GetAwaiter().GetResult();
+            return false;
+        }
+
+        private static unsafe bool OnText(IntPtr text, UIntPtr length, IntPtr userData)
+        {
+            // no exception may unwind into the native frames, any failure stops the generation
+            try
+            {
+                var stream = (TextStreamChannel)GCHandle.FromIntPtr(userData).Target!;
+                return stream.Push(Encoding.UTF8.GetString((byte*)text, checked((int)length.ToUInt64())));
+            }
+            catch (Exception)
+            {
+                return true;
+            }
+        }
+
+#if NET5_0_OR_GREATER
+        [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+        private static unsafe byte OnTextUnmanaged(byte* text, UIntPtr length, IntPtr userData)
+        {
+            return OnText((IntPtr)text, length, userData) ? (byte)1 : (byte)0;
+        }
+#endif
+
+        /// <summary>
+        /// Frees the GCHandle, call it only once the native side no longer holds the streamer.
+        /// </summary>
+        public void Dispose()
+        {
+            if (self.IsAllocated)
+                self.Free();
+            cancellation.Dispose();
+        }
+    }
+}
@@ -0,0 +1,35 @@
+﻿using System;
+
+namespace OpenVinoSharp.GenAI
+{
+    /// <summary>
+    /// One piece of text streamed from a generation.
+    /// </summary>
+    public readonly struct TokenChunk
+    {
+        /// <summary>
+        /// Constructor
+        /// </summary>
+        /// <param name="text">The text.</param>
+        /// <param name="index">The position of the chunk in its stream.</param>
+        public TokenChunk(string text, int index)
+        {
+            Text = text;
+            Index = index;
+        }
+
+        /// <summary>
+        /// The text decoded from one or more new tokens. A token ending inside a multi-byte character
+        /// is held back until the character is complete, so the text is always valid.
+        /// </summary>
+        public string Text { get; }
+
+        /// <summary>
+        /// The position of the chunk in its stream, from 0.
+        /// </summary>
+        public int Index { get; }
+
+        /// <inheritdoc />
+        public override string ToString() => Text;
+    }
+}